@@ -0,0 +1,502 @@
+\ ops: 1000
+\ a script evaluating the same top-level blocks again, one op per block
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
+1 if 2 3 + drop else 4 drop then 3 0 do i drop loop
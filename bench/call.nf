@@ -0,0 +1,6 @@
+\ ops: 1000000
+\ calls of a short compiled word, measures nf_call_word overhead
+: 1 + ; "inc" def
+"inc" noinline
+: inc inc inc inc inc inc inc inc inc inc ; "inc10" def
+0 100000 begin swap inc10 swap 1 - dup 0 == until drop drop
@@ -0,0 +1,4 @@
+\ ops: 1000000
+\ a counted loop adding a product of constants, folded into one literal
+7 "step" const
+0 1000000 0 do step 2 * + loop drop
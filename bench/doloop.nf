@@ -0,0 +1,3 @@
+\ ops: 1000000
+\ empty counted loop, the do/loop equivalent of loop.nf
+1000000 0 do loop
@@ -0,0 +1,5 @@
+\ ops: 1000000
+\ the same as call.nf, with inc inlined
+: 1 + ; "inc" def
+: inc inc inc inc inc inc inc inc inc inc ; "inc10" def
+0 100000 begin swap inc10 swap 1 - dup 0 == until drop drop
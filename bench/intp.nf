@@ -0,0 +1,1002 @@
+\ ops: 14000
+\ top-level interpretation, measures nf_parse_token and nf_lookup_word
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
+1 2 + 3 * 4 swap 0x10 rot over drop drop drop drop
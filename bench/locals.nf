@@ -0,0 +1,4 @@
+\ ops: 100000
+\ a word taking two arguments in locals, a*a + b*b
+: { a b } a a * b b * + ; "sumsq" def
+100000 0 do 3 4 sumsq drop loop
@@ -0,0 +1,3 @@
+\ ops: 1000000
+\ empty counted loop, measures bytecode dispatch
+1000000 begin 1 - dup 0 == until drop
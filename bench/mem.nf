@@ -0,0 +1,5 @@
+\ ops: 1024000
+\ fill, copy and sum a 1024-cell buffer 1000 times, one op per cell
+1024 cells allot "a" var
+1024 cells allot "b" var
+1000 0 do a 1024 cells 1 fill a b 1024 cells move b 1024 sum drop loop
@@ -0,0 +1,4 @@
+\ ops: 1000000
+\ a counted loop calling a quotation through execute
+[ 1 + ] "inc" var
+0 1000000 0 do inc execute loop drop
@@ -0,0 +1,6 @@
+\ ops: 1000000
+\ stack primitives, measures nf_data_check and push/pop
+100000 begin
+    1 2 3 rot swap over drop drop drop drop
+    1 - dup 0 ==
+until drop
@@ -0,0 +1,7 @@
+\ ops: 3069000
+\ strlen, strcmp and strstr over a 1023-byte string 1000 times, one op per byte
+1024 allot "a" var
+1024 allot "b" var
+a 1020 97 fill "xyz" a 1020 + strcpy
+a b strcpy
+1000 0 do a strlen drop a b strcmp drop a "xyz" strstr drop loop
@@ -0,0 +1,4 @@
+\ ops: 1000000
+\ tail-recursive count down, compiled into a loop
+: dup if 1 - recurse then ; "down" def
+1000000 down drop
@@ -0,0 +1,4 @@
+\ ops: 100000
+\ variable read and assignment, compiled into a direct fetch and store
+0 "counter" var
+100000 begin counter 1 + "counter" := 1 - dup 0 == until drop
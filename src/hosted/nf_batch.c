@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2026 luke8086.
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * hosted/nf_batch.c - parallel script runner
+ *
+ * Usage: nf_batch [-j workers] script...
+ *
+ * Every script is interpreted by a fresh machine, in a pool of worker
+ * threads. The machines share the dictionary of a base machine, which is
+ * created and runs the init code only once, see nf_fork_machine.
+ *
+ * Scripts are dealt to the queues of the workers in turn. Each worker
+ * takes scripts from the front of its own queue, and when it's empty,
+ * steals from the back of the others. The output of each script is
+ * captured, and printed in the order of the command line as soon as the
+ * preceding scripts are finished. A summary goes to stderr.
+ *
+ * Everything a script allocates is released after it finishes. The heap,
+ * tasks, interrupt flags and output of the core are kept per thread, see
+ * NF_THREAD_LOCAL. No signals are caught, instead the main thread raises
+ * the timer interrupt of every worker once per time slice, which switches
+ * their tasks and lets the watchdog abort runaway scripts. Profiler
+ * counters are kept per machine, see nf_prof.c.
+ */
+
+#define _XOPEN_SOURCE 700
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "nf_host.h"
+
+/* interval of the timer interrupt of the workers, as SIGALRM in nf */
+#define NF_BATCH_TICK_NS 10000000L
+
+struct nf_batch_job {
+    char *name;
+    char *out;
+    size_t out_len;
+    int ret;
+    int done;
+};
+
+struct nf_batch_worker {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    int *queue;
+    int head;
+    int tail;
+    int steals;
+    nf_irq_flag_t *irq_pending;
+};
+
+static struct nf_machine *nf_batch_base;
+static struct nf_batch_job *nf_batch_jobs;
+static struct nf_batch_worker *nf_batch_workers;
+static int nf_batch_worker_count;
+
+/* signalled when a job is done */
+static pthread_mutex_t nf_batch_done_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t nf_batch_done_cond = PTHREAD_COND_INITIALIZER;
+
+/* local functions */
+static int nf_batch_pop(struct nf_batch_worker *w, int steal);
+static int nf_batch_take(struct nf_batch_worker *w);
+static void nf_batch_run(struct nf_batch_job *job);
+static void *nf_batch_worker_main(void *arg);
+static void nf_batch_tick(void);
+static void nf_batch_wait(struct nf_batch_job *job);
+
+/* remove a job from the front of the queue, or the back when stealing */
+static int
+nf_batch_pop(struct nf_batch_worker *w, int steal)
+{
+    int job = -1;
+
+    pthread_mutex_lock(&w->lock);
+
+    if (w->head < w->tail) {
+        job = steal ? w->queue[--w->tail] : w->queue[w->head++];
+    }
+
+    pthread_mutex_unlock(&w->lock);
+
+    return job;
+}
+
+/* return the next job for a worker, or -1 if all queues are empty */
+static int
+nf_batch_take(struct nf_batch_worker *w)
+{
+    int i, job;
+
+    job = nf_batch_pop(w, 0);
+
+    /* no jobs are added later, so empty queues stay empty */
+    for (i = 1; job < 0 && i < nf_batch_worker_count; ++i) {
+        job = nf_batch_pop(&nf_batch_workers[(w - nf_batch_workers + i) %
+                                             nf_batch_worker_count], 1);
+        w->steals += (job >= 0);
+    }
+
+    return job;
+}
+
+/* interpret a script in a fresh machine, capturing its output */
+static void
+nf_batch_run(struct nf_batch_job *job)
+{
+    struct nf_machine *m;
+    jmp_buf exit_jmp;
+    FILE *out;
+    void *mark;
+    char *text;
+    size_t len;
+
+    out = open_memstream(&job->out, &job->out_len);
+    nf_host_out = out ? out : stdout;
+    mark = nf_host_heap_mark();
+
+    text = nf_read_file(job->name, &len);
+
+    if (!text) {
+        nf_error(("cannot read %s", job->name));
+        job->ret = 1;
+    } else if (setjmp(exit_jmp)) {
+        /* 'exit' only ends the script */
+        job->ret = nf_host_exit_code;
+    } else {
+        nf_host_exit_jmp = &exit_jmp;
+        m = nf_fork_machine(nf_batch_base);
+
+        if (m) {
+            m->argc = 1;
+            m->argv = &job->name;
+        }
+
+        job->ret = (!m || nf_intp_text(m, text, text + len)) ? 1 : 0;
+    }
+
+    nf_host_exit_jmp = 0;
+    free(text);
+
+    /* the machine and its tasks are gone */
+    nf_task_reset();
+    nf_host_heap_release(mark);
+
+    nf_host_out = 0;
+    if (out) {
+        fclose(out);
+    }
+
+    pthread_mutex_lock(&nf_batch_done_lock);
+    job->done = 1;
+    pthread_cond_broadcast(&nf_batch_done_cond);
+    pthread_mutex_unlock(&nf_batch_done_lock);
+}
+
+/* worker thread */
+static void *
+nf_batch_worker_main(void *arg)
+{
+    struct nf_batch_worker *w = arg;
+    int job;
+
+    pthread_mutex_lock(&w->lock);
+    w->irq_pending = &nf_irq_pending;
+    pthread_mutex_unlock(&w->lock);
+
+    while ((job = nf_batch_take(w)) >= 0) {
+        nf_batch_run(&nf_batch_jobs[job]);
+    }
+
+    /* the flag is gone with the thread */
+    pthread_mutex_lock(&w->lock);
+    w->irq_pending = 0;
+    pthread_mutex_unlock(&w->lock);
+
+    return 0;
+}
+
+/* raise the timer interrupt of every running worker */
+static void
+nf_batch_tick(void)
+{
+    struct nf_batch_worker *w;
+    int i;
+
+    for (i = 0; i < nf_batch_worker_count; ++i) {
+        w = &nf_batch_workers[i];
+
+        pthread_mutex_lock(&w->lock);
+        if (w->irq_pending) {
+            NF_IRQ_STORE(*w->irq_pending, 1);
+        }
+        pthread_mutex_unlock(&w->lock);
+    }
+}
+
+/* wait until a job is done, ticking the workers meanwhile */
+static void
+nf_batch_wait(struct nf_batch_job *job)
+{
+    static nf_clock_t last = 0;
+    struct timespec ts;
+    nf_clock_t now;
+
+    pthread_mutex_lock(&nf_batch_done_lock);
+
+    while (!job->done) {
+        /* other jobs finishing mustn't hold off the tick */
+        now = nf_clock();
+        if (now - last >= NF_BATCH_TICK_NS) {
+            nf_batch_tick();
+            last = now;
+        }
+
+        clock_gettime(CLOCK_REALTIME, &ts);
+        ts.tv_nsec += NF_BATCH_TICK_NS;
+        if (ts.tv_nsec >= 1000000000L) {
+            ts.tv_nsec -= 1000000000L;
+            ++ts.tv_sec;
+        }
+
+        pthread_cond_timedwait(&nf_batch_done_cond, &nf_batch_done_lock, &ts);
+    }
+
+    pthread_mutex_unlock(&nf_batch_done_lock);
+}
+
+/* main entry point */
+int
+main(int argc, char **argv)
+{
+    struct nf_batch_job *job;
+    nf_clock_t start, ns;
+    int i, first = 1, count, failed = 0, steals = 0;
+    long workers;
+
+    workers = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (argc > 2 && !strcmp(argv[1], "-j")) {
+        workers = atoi(argv[2]);
+        first = 3;
+    }
+
+    count = argc - first;
+
+    if (count < 1 || workers < 1) {
+        fprintf(stderr, "Usage: nf_batch [-j workers] script...\n");
+        return 1;
+    }
+
+    if (workers > count) {
+        workers = count;
+    }
+
+    nf_batch_jobs = calloc(count, sizeof(struct nf_batch_job));
+    nf_batch_workers = calloc(workers, sizeof(struct nf_batch_worker));
+
+    if (!nf_batch_jobs || !nf_batch_workers) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    nf_batch_worker_count = workers;
+
+    /* deal the jobs */
+    for (i = 0; i < workers; ++i) {
+        nf_batch_workers[i].queue = calloc(count / workers + 1, sizeof(int));
+        pthread_mutex_init(&nf_batch_workers[i].lock, 0);
+    }
+
+    for (i = 0; i < count; ++i) {
+        struct nf_batch_worker *w = &nf_batch_workers[i % workers];
+
+        nf_batch_jobs[i].name = argv[first + i];
+        w->queue[w->tail++] = i;
+    }
+
+    start = nf_clock();
+
+    /* the base is only read by the workers, see nf_define_word */
+    nf_batch_base = nf_host_machine(argc, argv);
+
+    if (!nf_batch_base) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    for (i = 0; i < workers; ++i) {
+        if (pthread_create(&nf_batch_workers[i].thread, 0,
+                           nf_batch_worker_main, &nf_batch_workers[i])) {
+            fprintf(stderr, "cannot create a thread\n");
+            return 1;
+        }
+    }
+
+    /* print the output in order, while the rest is running */
+    for (i = 0; i < count; ++i) {
+        job = &nf_batch_jobs[i];
+
+        nf_batch_wait(job);
+
+        fwrite(job->out, 1, job->out_len, stdout);
+        fflush(stdout);
+        free(job->out);
+
+        failed += (job->ret != 0);
+    }
+
+    for (i = 0; i < workers; ++i) {
+        pthread_join(nf_batch_workers[i].thread, 0);
+        steals += nf_batch_workers[i].steals;
+    }
+
+    ns = nf_clock() - start;
+
+    fprintf(stderr, "%d scripts, %d failed, %ld workers, %d steals: "
+            "%.2f ms, %.1f scripts/s\n", count, failed, workers, steals,
+            ns / 1e6, count / (ns / 1e9));
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 luke8086.
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * hosted/nf_bench.c - benchmark runner
+ *
+ * Usage: nf_bench [-r runs] script...
+ *
+ * Each script is interpreted by a fresh machine several times with the
+ * output discarded, and the fastest run is reported. A script starting
+ * with a "\ ops: N" comment line is divided into N operations, so the
+ * result is shown in nanoseconds per operation.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nf_host.h"
+
+#define NF_BENCH_RUNS 5
+
+/* local functions */
+static unsigned long nf_bench_ops(const char *text);
+static int nf_bench_run(char *name, const char *text, size_t len,
+                        nf_clock_t *ns);
+
+/* parse the "\ ops: N" header, return 1 if there's none */
+static unsigned long
+nf_bench_ops(const char *text)
+{
+    unsigned long ops;
+
+    if (strncmp(text, "\\ ops:", 6) != 0) {
+        return 1;
+    }
+
+    ops = strtoul(text + 6, 0, 10);
+
+    return ops ? ops : 1;
+}
+
+/* interpret a script in a fresh machine and free it, return 0 on success */
+static int
+nf_bench_run(char *name, const char *text, size_t len, nf_clock_t *ns)
+{
+    struct nf_machine *m;
+    nf_clock_t start;
+    void *mark;
+    int ret = -1;
+
+    mark = nf_host_heap_mark();
+    m = nf_host_machine(1, &name);
+
+    if (m) {
+        start = nf_clock();
+        ret = nf_intp_text(m, text, text + len);
+        *ns = nf_clock() - start;
+    }
+
+    /* the machine and its tasks are gone */
+    nf_task_reset();
+    nf_host_heap_release(mark);
+
+    return ret;
+}
+
+/* main entry point */
+int
+main(int argc, char **argv)
+{
+    nf_clock_t ns, best;
+    unsigned long ops;
+    int runs = NF_BENCH_RUNS;
+    int i, r, err, ret = 0;
+    char *text;
+    size_t len;
+
+    i = 1;
+
+    if (argc > 2 && !strcmp(argv[1], "-r")) {
+        runs = atoi(argv[2]);
+        i = 3;
+    }
+
+    if (i >= argc || runs < 1) {
+        fprintf(stderr, "Usage: nf_bench [-r runs] script...\n");
+        return 1;
+    }
+
+    for (; i < argc; ++i) {
+        text = nf_read_file(argv[i], &len);
+
+        if (!text) {
+            fprintf(stderr, "cannot read %s\n", argv[i]);
+            return 1;
+        }
+
+        ops = nf_bench_ops(text);
+        best = 0;
+        err = 0;
+
+        nf_host_quiet = 1;
+
+        for (r = 0; r < runs && !err; ++r) {
+            err = nf_bench_run(argv[i], text, len, &ns);
+            if (r == 0 || ns < best) {
+                best = ns;
+            }
+        }
+
+        nf_host_quiet = 0;
+
+        if (err) {
+            printf("%-24s failed, run it with nf to see the errors\n", argv[i]);
+            ret = 1;
+        } else {
+            printf("%-24s %12.2f ns/op %10lu ops\n", argv[i],
+                   (double)best / ops, ops);
+        }
+
+        fflush(stdout);
+        free(text);
+    }
+
+    return ret;
+}
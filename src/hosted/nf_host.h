@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026 luke8086.
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * hosted/nf_host.h - declarations of the hosted platform functions
+ */
+
+#ifndef _NF_HOST_H_
+#define _NF_HOST_H_
+
+#include <setjmp.h>
+#include <stdio.h>
+
+#include "nf_cmmn.h"
+
+/* embedded init code (from nf_strt.c) */
+extern const char nf_init_code[];
+extern const char nf_init_code_end[];
+
+/* nf_libc.c */
+extern NF_THREAD_LOCAL int nf_host_quiet;
+extern NF_THREAD_LOCAL FILE *nf_host_out;
+extern NF_THREAD_LOCAL jmp_buf *nf_host_exit_jmp;
+extern NF_THREAD_LOCAL int nf_host_exit_code;
+void *nf_host_heap_mark(void);
+void nf_host_heap_release(void *mark);
+char *nf_readline(void);
+char *nf_read_file(const char *name, size_t *len);
+
+/* nf_words.c */
+void nf_define_host_words(struct nf_machine *m);
+struct nf_machine *nf_host_machine(int argc, char **argv);
+
+#endif /* _NF_HOST_H_ */
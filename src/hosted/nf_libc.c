@@ -0,0 +1,418 @@
+/*
+ * Copyright (c) 2026 luke8086.
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * hosted/nf_libc.c - standard library on top of the C library
+ */
+
+#define _XOPEN_SOURCE 700
+
+#include <poll.h>
+#include <setjmp.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+#include <ucontext.h>
+
+#include "nf_host.h"
+
+/* when set, output is discarded, e.g. while benchmarking */
+NF_THREAD_LOCAL int nf_host_quiet = 0;
+
+/* when set, output goes there instead of stdout, see nf_batch.c */
+NF_THREAD_LOCAL FILE *nf_host_out = 0;
+
+/* when set, nf_exit jumps there instead of exiting, see nf_batch.c */
+NF_THREAD_LOCAL jmp_buf *nf_host_exit_jmp = 0;
+NF_THREAD_LOCAL int nf_host_exit_code = 0;
+
+/* cursor x position, tracked by nf_write */
+static NF_THREAD_LOCAL int nf_column = 0;
+
+/* buffer for nf_readline */
+static char nf_readline_buf[NF_LINE_BUF_SIZE];
+
+/* task context, see nf_task.c */
+#define NF_TASK_STACK_SIZE 65536
+
+struct nf_ctx {
+    ucontext_t uc;
+    char stack[NF_TASK_STACK_SIZE];
+};
+
+static NF_THREAD_LOCAL struct nf_ctx nf_ctx_console;
+
+/*
+ * set by signal handlers, see nf_irq.c. kept per thread, so that nf_batch
+ * can interrupt every worker on its own
+ */
+NF_THREAD_LOCAL nf_irq_flag_t nf_irq_pending = 0;
+NF_THREAD_LOCAL nf_irq_flag_t nf_irq_break = 0;
+
+/* interval of SIGALRM, i.e. the task time slice */
+#define NF_IRQ_TIMER_US 10000
+
+/*
+ * the heap of each thread is a list of blocks allocated by nf_malloc, most
+ * recent first, so that everything allocated by a machine can be released
+ * at once, see nf_host_heap_release
+ */
+struct nf_heap_block {
+    struct nf_heap_block *prev;
+    size_t size;
+};
+
+/* size of the block header, keeping the data aligned as by malloc */
+#define NF_HEAP_HDR_SIZE ((sizeof(struct nf_heap_block) + 15) & ~15)
+
+static NF_THREAD_LOCAL struct nf_heap_block *nf_heap_top = 0;
+
+/* amount of memory allocated by nf_malloc */
+static NF_THREAD_LOCAL size_t nf_heap_total = 0;
+
+/* allocate chunk of memory on the heap */
+void *
+nf_malloc(size_t size)
+{
+    struct nf_heap_block *b;
+
+    b = malloc(NF_HEAP_HDR_SIZE + size);
+    if (!b) {
+        return 0;
+    }
+
+    b->prev = nf_heap_top;
+    b->size = size;
+
+    nf_heap_top = b;
+    nf_heap_total += size;
+
+    return (char *)b + NF_HEAP_HDR_SIZE;
+}
+
+/* single chunks are not freed, as in DOS. see nf_host_heap_release */
+void
+nf_free(void *ptr)
+{
+    (void)ptr;
+}
+
+/* return the current top of the heap, to be passed to nf_host_heap_release */
+void *
+nf_host_heap_mark(void)
+{
+    return nf_heap_top;
+}
+
+/* free everything allocated by nf_malloc since the given mark */
+void
+nf_host_heap_release(void *mark)
+{
+    struct nf_heap_block *b;
+
+    while (nf_heap_top && nf_heap_top != mark) {
+        b = nf_heap_top;
+        nf_heap_top = b->prev;
+        nf_heap_total -= b->size;
+        free(b);
+    }
+}
+
+/* return amount of memory allocated by nf_malloc */
+size_t
+nf_heap_used(void)
+{
+    return nf_heap_total;
+}
+
+/* the heap is only limited by the system */
+size_t
+nf_heap_free(void)
+{
+    return 0;
+}
+
+/* the C stack is not measured in hosted builds */
+void
+nf_stack_paint(void)
+{
+}
+
+size_t
+nf_stack_peak(void)
+{
+    return 0;
+}
+
+/* memory and string functions, on top of the vectorized ones of the C library */
+void *
+nf_memcpy(void *dest, const void *src, size_t n)
+{
+    return memcpy(dest, src, n);
+}
+
+int
+nf_memcmp(const void *s1, const void *s2, size_t n)
+{
+    return memcmp(s1, s2, n);
+}
+
+void *
+nf_memchr(const void *s, int c, size_t n)
+{
+    return memchr(s, c, n);
+}
+
+size_t
+nf_strlen(const char *s1)
+{
+    return strlen(s1);
+}
+
+int
+nf_strcmp(const char *s1, const char *s2)
+{
+    return strcmp(s1, s2);
+}
+
+/* get current cursor x position */
+int
+nf_getx(void)
+{
+    return nf_column;
+}
+
+/* print a single character to the screen */
+void
+nf_putc(unsigned char c)
+{
+    nf_write((char *)&c, 1);
+}
+
+/* print a buffer of n characters to the screen */
+void
+nf_write(const char *s, size_t n)
+{
+    size_t i;
+
+    if (nf_host_quiet) {
+        return;
+    }
+
+    for (i = 0; i < n; ++i) {
+        nf_column = (s[i] == '\n') ? 0 : nf_column + 1;
+    }
+
+    fwrite(s, 1, n, nf_host_out ? nf_host_out : stdout);
+}
+
+/* prepare ctx, or a new context if 0, to run entry on its own stack */
+void *
+nf_ctx_init(void *ctx, void (*entry)(void))
+{
+    struct nf_ctx *c = ctx;
+
+    if (!c) {
+        c = nf_malloc(sizeof(struct nf_ctx));
+        if (!c) {
+            return 0;
+        }
+    }
+
+    getcontext(&c->uc);
+    c->uc.uc_stack.ss_sp = c->stack;
+    c->uc.uc_stack.ss_size = sizeof(c->stack);
+    c->uc.uc_link = 0;
+    makecontext(&c->uc, entry, 0);
+
+    return c;
+}
+
+/* return context of the console, saved when switching to a task */
+void *
+nf_ctx_main(void)
+{
+    return &nf_ctx_console;
+}
+
+/* save the current context in from and resume to */
+void
+nf_ctx_switch(void *from, void *to)
+{
+    swapcontext(&((struct nf_ctx *)from)->uc, &((struct nf_ctx *)to)->uc);
+}
+
+/* SIGALRM and SIGINT handler */
+static void
+nf_irq_signal(int sig)
+{
+    if (sig == SIGINT) {
+        NF_IRQ_STORE(nf_irq_break, 1);
+    }
+
+    NF_IRQ_STORE(nf_irq_pending, 1);
+}
+
+/* start the time slice timer and catch SIGINT as Ctrl-Break */
+void
+nf_irq_init(void)
+{
+    struct sigaction sa;
+    struct itimerval it;
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = nf_irq_signal;
+    sigemptyset(&sa.sa_mask);
+
+    /* SIGINT interrupts nf_readline, see below */
+    sigaction(SIGINT, &sa, 0);
+
+    sa.sa_flags = SA_RESTART;
+    sigaction(SIGALRM, &sa, 0);
+
+    it.it_interval.tv_sec = 0;
+    it.it_interval.tv_usec = NF_IRQ_TIMER_US;
+    it.it_value = it.it_interval;
+    setitimer(ITIMER_REAL, &it, 0);
+}
+
+/* stop the timer and restore default SIGINT handling */
+void
+nf_irq_done(void)
+{
+    struct itimerval it;
+
+    memset(&it, 0, sizeof(it));
+    setitimer(ITIMER_REAL, &it, 0);
+
+    signal(SIGINT, SIG_DFL);
+}
+
+/* read a line of text, return 0 at the end of input */
+char *
+nf_readline(void)
+{
+    struct pollfd pfd;
+    size_t len;
+
+    fflush(stdout);
+
+    /* let other tasks run until there's input */
+    pfd.fd = 0;
+    pfd.events = POLLIN;
+
+    while (nf_task_count() > 1 && !NF_IRQ_LOAD(nf_irq_break) &&
+           poll(&pfd, 1, 1) <= 0) {
+        nf_task_yield();
+    }
+
+    if (!fgets(nf_readline_buf, sizeof(nf_readline_buf), stdin)) {
+        if (!NF_IRQ_LOAD(nf_irq_break)) {
+            return 0;
+        }
+
+        /* Ctrl-C at the prompt discards the line */
+        clearerr(stdin);
+        nf_readline_buf[0] = '\0';
+        nf_printf("\n");
+    }
+
+    NF_IRQ_STORE(nf_irq_break, 0);
+
+    len = strlen(nf_readline_buf);
+    while (len > 0 && (nf_readline_buf[len - 1] == '\n' ||
+                       nf_readline_buf[len - 1] == '\r')) {
+        nf_readline_buf[--len] = '\0';
+    }
+
+    nf_column = 0;
+
+    return nf_readline_buf;
+}
+
+/* read a whole file into a new buffer, return 0 on error */
+char *
+nf_read_file(const char *name, size_t *len)
+{
+    FILE *f;
+    char *buf = 0;
+    long size;
+
+    f = fopen(name, "rb");
+    if (!f) {
+        return 0;
+    }
+
+    if (fseek(f, 0, SEEK_END) == 0 && (size = ftell(f)) >= 0 &&
+        fseek(f, 0, SEEK_SET) == 0) {
+        buf = malloc(size + 1);
+        if (buf && fread(buf, 1, size, f) != (size_t)size) {
+            free(buf);
+            buf = 0;
+        }
+    }
+
+    fclose(f);
+
+    if (buf) {
+        buf[size] = '\0';
+        *len = size;
+    }
+
+    return buf;
+}
+
+/* monotonic time in nanoseconds */
+nf_clock_t
+nf_clock(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (nf_clock_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* convert nf_clock ticks to microseconds */
+nf_clock_t
+nf_clock_to_us(nf_clock_t t)
+{
+    return t / 1000;
+}
+
+/* formatted print */
+int
+nf_printf(const char *format, ...)
+{
+    va_list ap;
+    char buf[1024];
+    int ret;
+
+    va_start(ap, format);
+    ret = nf_vsnprintf(buf, sizeof(buf), format, ap);
+    va_end(ap);
+
+    if (ret >= 0)
+        nf_write(buf, strlen(buf));
+
+    return ret;
+}
+
+/* exit interpreter with given status code */
+void
+nf_exit(char code)
+{
+    if (nf_host_exit_jmp) {
+        nf_host_exit_code = code;
+        longjmp(*nf_host_exit_jmp, 1);
+    }
+
+    nf_irq_done();
+    fflush(stdout);
+    exit(code);
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 luke8086.
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * hosted/nf_main.c - main interpreter loop
+ *
+ * Usage: nf [file...]
+ *
+ * Interprets given files and exits, or reads lines from the standard
+ * input if there are none.
+ */
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include "nf_host.h"
+
+/* local functions */
+static void nf_print_prompt(struct nf_machine *m);
+
+/* print a plain prompt */
+static void
+nf_print_prompt(struct nf_machine *m)
+{
+    if (nf_getx() != 0) {
+        nf_printf("\n");
+    }
+
+    nf_printf(m->state != NF_STATE_INTERPRET ? "... " : ">>> ");
+}
+
+/* main entry point */
+int
+main(int argc, char **argv)
+{
+    struct nf_machine *m;
+    char *line, *text;
+    size_t len;
+    int i, ret = 0;
+
+    m = nf_host_machine(argc, argv);
+
+    if (!m) {
+        nf_error(("out of memory"));
+        return 1;
+    }
+
+    nf_irq_init();
+
+    /* interpret files given on the command line */
+    if (argc > 1) {
+        for (i = 1; i < argc; ++i) {
+            text = nf_read_file(argv[i], &len);
+
+            if (!text) {
+                nf_error(("cannot read %s", argv[i]));
+                return 1;
+            }
+
+            if (nf_intp_text(m, text, text + len)) {
+                ret = 1;
+            }
+        }
+
+        nf_exit(ret);
+    }
+
+    /* interactive interpreter loop */
+    for (;;) {
+        if (isatty(0)) {
+            nf_print_prompt(m);
+        }
+
+        line = nf_readline();
+
+        if (!line) {
+            break;
+        }
+
+        (void)nf_intp_line(m, line);
+    }
+
+    nf_exit(0);
+
+    /* NOTREACHED */
+    return 0;
+}
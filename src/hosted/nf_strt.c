@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2026 luke8086.
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * hosted/nf_strt.c - embedded init code, as in nf_strt.asm
+ */
+
+#ifndef NF_INIT_PATH
+#define NF_INIT_PATH "src/nf_init.nf"
+#endif
+
+__asm__(
+    ".section .rodata\n"
+    ".global nf_init_code\n"
+    ".global nf_init_code_end\n"
+    "nf_init_code:\n"
+    ".incbin \"" NF_INIT_PATH "\"\n"
+    "nf_init_code_end:\n"
+    ".byte 0\n"
+    ".previous\n"
+);
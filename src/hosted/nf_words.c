@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026 luke8086.
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * hosted/nf_words.c - hosted platform specific words
+ */
+
+#include "nf_host.h"
+
+/* 'exit' ( -- ) */
+static int
+nf_word_exit(struct nf_machine *m)
+{
+    (void)m;
+
+    nf_exit(0);
+
+    /* NOTREACHED */
+    return 0;
+}
+
+#define NF_DECL_PRIM(name, data) { name, NF_WORD_PRIM, data, 0 }
+
+/* define hosted system words */
+void
+nf_define_host_words(struct nf_machine *m)
+{
+    int i, count;
+
+    static struct nf_word words[] = {
+        NF_DECL_PRIM("exit", (void*)nf_word_exit)
+    };
+
+    count = sizeof(words) / sizeof(words[0]);
+
+    for (i = 0; i < count; ++i) {
+        nf_define_word(m, &words[i]);
+    }
+}
+
+/* create a machine with hosted words and init code */
+struct nf_machine *
+nf_host_machine(int argc, char **argv)
+{
+    struct nf_machine *m;
+
+    m = nf_init_machine(argc, argv);
+
+    if (!m) {
+        return 0;
+    }
+
+    nf_define_host_words(m);
+    (void)nf_intp_text(m, nf_init_code, nf_init_code_end);
+
+    return m;
+}
@@ -155,6 +155,24 @@ nf_base_exec(struct nf_machine *m)
     return nf_exec(m, i);
 }
 
+/* 'execute' ( xt -- ) call a word by its token, see '[' and tick */
+static int
+nf_base_execute(struct nf_machine *m)
+{
+    struct nf_word *w;
+
+    if (nf_data_check(m, 1, 0))
+        return -1;
+
+    w = (struct nf_word *)nf_data_pop(m);
+    if (!w) {
+        nf_error(("invalid token"));
+        return -1;
+    }
+
+    return nf_call_word(m, w);
+}
+
 /* 'def' ( s -- ) */
 static int
 nf_base_def(struct nf_machine *m)
@@ -186,6 +204,14 @@ nf_base_def(struct nf_machine *m)
     }
     nf_define_word(m, w);
 
+    /* now that the word exists, 'recurse' can call it */
+    for (; i_count; --i_count, ++i) {
+        if (i->opcode == NF_OPCODE_RECURSE) {
+            i->opcode = NF_OPCODE_CALL;
+            i->value = (nf_cell_t)w;
+        }
+    }
+
     return 0;
 }
 
@@ -194,16 +220,16 @@ static int
 nf_base_var(struct nf_machine *m)
 {
     char *name;
-    void *val;
+    nf_cell_t val;
     struct nf_word *w;
 
     if (nf_data_check(m, 2, 0))
         return -1;
 
     name = (char *)nf_data_pop(m);
-    val = (void *)nf_data_pop(m);
+    val = nf_data_pop(m);
 
-    w = nf_init_word(m, name, NF_WORD_VAR, val);
+    w = nf_init_var(m, name, val);
     if (!w) {
         nf_error(("out of memory"));
         return -1;
@@ -213,26 +239,115 @@ nf_base_var(struct nf_machine *m)
     return 0;
 }
 
-/* ':=' ( n s -- ) */
+/* define a constant. on failure, display an error and return -1 */
 static int
-nf_base_assign(struct nf_machine *m)
+nf_base_define_const(struct nf_machine *m, char *name, nf_cell_t val)
 {
-    char *name;
-    void *val;
     struct nf_word *w;
 
+    w = nf_init_var(m, name, val);
+    if (!w) {
+        nf_error(("out of memory"));
+        return -1;
+    }
+    w->type = NF_WORD_CONST;
+    nf_define_word(m, w);
+
+    return 0;
+}
+
+/* 'const' ( n s -- ) */
+static int
+nf_base_const(struct nf_machine *m)
+{
+    char *name;
+    nf_cell_t val;
+
     if (nf_data_check(m, 2, 0))
         return -1;
 
     name = (char *)nf_data_pop(m);
-    val = (void *)nf_data_pop(m);
+    val = nf_data_pop(m);
+
+    return nf_base_define_const(m, name, val);
+}
+
+/* 'consts' ( n1 s1 .. nk sk k -- ) define k constants */
+static int
+nf_base_consts(struct nf_machine *m)
+{
+    nf_cell_t k;
+    nf_cell_t *p;
+
+    if (nf_data_check(m, 1, 0))
+        return -1;
 
-    w = nf_lookup_word(m, name);
-    if (!w || w->type != NF_WORD_VAR) {
-        nf_error(("unknown variable"));
+    k = nf_data_pop(m);
+
+    if (k < 0 || k > NF_DATA_STACK_SIZE) {
+        nf_error(("invalid count"));
+        return -1;
+    }
+
+    if (nf_data_check(m, (size_t)k * 2, 0))
+        return -1;
+
+    /* define them in order, so that the last one wins on duplicates */
+    m->data_sp -= k * 2;
+
+    for (p = m->data_sp; k; --k, p += 2) {
+        if (nf_base_define_const(m, (char *)p[1], p[0]))
+            return -1;
+    }
+
+    return 0;
+}
+
+/* 'enum' ( s1 .. sk k -- ) define constants numbered from 0 to k-1 */
+static int
+nf_base_enum(struct nf_machine *m)
+{
+    nf_cell_t k, i;
+    nf_cell_t *p;
+
+    if (nf_data_check(m, 1, 0))
+        return -1;
+
+    k = nf_data_pop(m);
+
+    if (k < 0 || k > NF_DATA_STACK_SIZE) {
+        nf_error(("invalid count"));
         return -1;
     }
-    w->data = val;
+
+    if (nf_data_check(m, (size_t)k, 0))
+        return -1;
+
+    m->data_sp -= k;
+
+    for (p = m->data_sp, i = 0; i < k; ++i) {
+        if (nf_base_define_const(m, (char *)p[i], i))
+            return -1;
+    }
+
+    return 0;
+}
+
+/* 'addr' ( s -- a ) push the address of a variable's storage cell */
+static int
+nf_base_addr(struct nf_machine *m)
+{
+    nf_cell_t *cell;
+
+    if (nf_data_check(m, 1, 1))
+        return -1;
+
+    cell = nf_var_cell(m, (char *)nf_data_pop(m));
+    if (!cell) {
+        return -1;
+    }
+
+    nf_data_push(m, (nf_cell_t)cell);
 
     return 0;
 }
@@ -341,6 +456,7 @@ nf_base_printf(struct nf_machine *m)
 }
 
 #define NF_DECL_PRIM(name, data) { name, NF_WORD_PRIM, data, 0 }
+#define NF_DECL_OPER(name, data, n) { name, NF_WORD_PRIM, data, 0, n }
 
 /* append base words to the dictionary */
 void
@@ -353,29 +469,33 @@ nf_define_base_words(struct nf_machine *m)
         NF_DECL_PRIM("over",   (void*)nf_base_over),
         NF_DECL_PRIM("rot",    (void*)nf_base_rot),
 
-        NF_DECL_PRIM("+",      (void*)nf_base_add),
-        NF_DECL_PRIM("-",      (void*)nf_base_sub),
-        NF_DECL_PRIM("*",      (void*)nf_base_mul),
+        NF_DECL_OPER("+",      (void*)nf_base_add, 2),
+        NF_DECL_OPER("-",      (void*)nf_base_sub, 2),
+        NF_DECL_OPER("*",      (void*)nf_base_mul, 2),
         NF_DECL_PRIM("/",      (void*)nf_base_div),
         NF_DECL_PRIM("%",      (void*)nf_base_mod),
-        NF_DECL_PRIM("&&",     (void*)nf_base_bool_and),
-        NF_DECL_PRIM("||",     (void*)nf_base_bool_or),
-        NF_DECL_PRIM("!",      (void*)nf_base_bool_not),
-        NF_DECL_PRIM("&",      (void*)nf_base_bit_and),
-        NF_DECL_PRIM("|",      (void*)nf_base_bit_or),
-        NF_DECL_PRIM("^",      (void*)nf_base_bit_xor),
-        NF_DECL_PRIM("~",      (void*)nf_base_bit_not),
-        NF_DECL_PRIM("==",     (void*)nf_base_eq),
-        NF_DECL_PRIM("!=",     (void*)nf_base_ne),
-        NF_DECL_PRIM("<",      (void*)nf_base_lt),
-        NF_DECL_PRIM(">",      (void*)nf_base_gt),
-        NF_DECL_PRIM("<=",     (void*)nf_base_le),
-        NF_DECL_PRIM(">=",     (void*)nf_base_ge),
+        NF_DECL_OPER("&&",     (void*)nf_base_bool_and, 2),
+        NF_DECL_OPER("||",     (void*)nf_base_bool_or, 2),
+        NF_DECL_OPER("!",      (void*)nf_base_bool_not, 1),
+        NF_DECL_OPER("&",      (void*)nf_base_bit_and, 2),
+        NF_DECL_OPER("|",      (void*)nf_base_bit_or, 2),
+        NF_DECL_OPER("^",      (void*)nf_base_bit_xor, 2),
+        NF_DECL_OPER("~",      (void*)nf_base_bit_not, 1),
+        NF_DECL_OPER("==",     (void*)nf_base_eq, 2),
+        NF_DECL_OPER("!=",     (void*)nf_base_ne, 2),
+        NF_DECL_OPER("<",      (void*)nf_base_lt, 2),
+        NF_DECL_OPER(">",      (void*)nf_base_gt, 2),
+        NF_DECL_OPER("<=",     (void*)nf_base_le, 2),
+        NF_DECL_OPER(">=",     (void*)nf_base_ge, 2),
 
         NF_DECL_PRIM("exec",   (void*)nf_base_exec),
+        NF_DECL_PRIM("execute", (void*)nf_base_execute),
         NF_DECL_PRIM("def",    (void*)nf_base_def),
         NF_DECL_PRIM("var",    (void*)nf_base_var),
-        NF_DECL_PRIM(":=",     (void*)nf_base_assign),
+        NF_DECL_PRIM("const",  (void*)nf_base_const),
+        NF_DECL_PRIM("consts", (void*)nf_base_consts),
+        NF_DECL_PRIM("enum",   (void*)nf_base_enum),
+        NF_DECL_PRIM("addr",   (void*)nf_base_addr),
 
         NF_DECL_PRIM("argc",   (void*)nf_base_argc),
         NF_DECL_PRIM("argv",   (void*)nf_base_argv),
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026 luke8086.
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * nf_blkc.c - cache of top-level blocks
+ *
+ * At top level, 'if', 'begin' and 'do' compile everything up to the
+ * matching 'then', 'repeat', 'until' or 'loop' into comp_buf and execute
+ * it once. Blocks which open and close on the same line are cached here,
+ * keyed by their source text, so that evaluating the same text again only
+ * copies the bytecode back to comp_buf, and skips the rest of the line up
+ * to the end of the block.
+ *
+ * The bytecode depends on the words named in the block, which are resolved,
+ * folded and inlined when compiled. Each entry remembers the dictionary it
+ * was compiled with, and it's dropped once a word with a name appearing in
+ * its text is defined, or marked with 'noinline'. Nothing is cached while
+ * the profiler is on, since inlining is disabled then. Blocks with string
+ * literals aren't cached either, since every evaluation gets new copies of
+ * the strings, which it may modify. Names that ':=' and tick resolve when
+ * compiled don't count.
+ *
+ * nf_free doesn't release memory, so every entry gets storage of a fixed
+ * size once, reused by the blocks replacing it. Larger blocks aren't
+ * cached.
+ */
+
+#include "nf_cmmn.h"
+
+/* storage of an entry, for the bytecode and the text of a block */
+#define NF_BLOCK_STORAGE (64 * sizeof(struct nf_instr))
+
+/* local functions */
+static int nf_block_is_sep(int c);
+static int nf_block_refers(struct nf_block *b, char *name);
+static int nf_block_valid(struct nf_machine *m, struct nf_block *b);
+
+/* check for a character separating names in the source text */
+static int
+nf_block_is_sep(int c)
+{
+    return (c == 0 || c == '"' || c == ' ' || c == '\f' || c == '\n' ||
+            c == '\r' || c == '\t' || c == '\v');
+}
+
+/* check if the source text of b contains name as a whole token */
+static int
+nf_block_refers(struct nf_block *b, char *name)
+{
+    size_t len = nf_strlen(name);
+    char *p = b->src;
+
+    while ((p = nf_strstr(p, name)) != 0) {
+        if ((p == b->src || nf_block_is_sep(p[-1])) &&
+            nf_block_is_sep(p[len])) {
+            return 1;
+        }
+        ++p;
+    }
+
+    return 0;
+}
+
+/* check if words defined since b was compiled leave it valid */
+static int
+nf_block_valid(struct nf_machine *m, struct nf_block *b)
+{
+    struct nf_word *w;
+
+    for (w = m->words; w != b->words; w = w->next) {
+        if (!w || nf_block_refers(b, w->name)) {
+            return 0;
+        }
+    }
+
+    /* don't check the same words again */
+    b->words = m->words;
+
+    return 1;
+}
+
+/* empty the cache, forgetting the storage of its entries too */
+void
+nf_block_reset(struct nf_machine *m)
+{
+    int i;
+
+    for (i = 0; i < NF_BLOCK_CACHE_SIZE; ++i) {
+        m->blocks[i].src = 0;
+        m->blocks[i].cap = 0;
+    }
+
+    m->block_src = 0;
+    m->block_pos = 0;
+    m->block_strs = 0;
+}
+
+/* drop cached blocks referring to a word changed in place */
+void
+nf_block_forget(struct nf_machine *m, char *name)
+{
+    int i;
+
+    for (i = 0; i < NF_BLOCK_CACHE_SIZE; ++i) {
+        if (m->blocks[i].src && nf_block_refers(&m->blocks[i], name)) {
+            m->blocks[i].src = 0;
+        }
+    }
+}
+
+/*
+ * called by a word opening a top-level block, with its name. if the block
+ * starting there is cached, copy its bytecode to comp_buf, skip its text,
+ * and return 1. otherwise, remember where it starts and return 0
+ */
+int
+nf_block_find(struct nf_machine *m, char *name)
+{
+    struct nf_block *b;
+    size_t rest;
+    char *src;
+    int i;
+
+    m->block_src = 0;
+
+    /* the name is the last token parsed by nf_intp_line */
+    if (!m->src_next || m->profile) {
+        return 0;
+    }
+
+    src = m->src_next - nf_strlen(name);
+    rest = nf_strlen(src);
+
+    for (i = 0; i < NF_BLOCK_CACHE_SIZE; ++i) {
+        b = &m->blocks[i];
+
+        if (!b->src || b->len > rest || nf_memcmp(src, b->src, b->len) ||
+            !nf_block_is_sep(src[b->len])) {
+            continue;
+        }
+
+        if (!nf_block_valid(m, b)) {
+            b->src = 0;
+            break;
+        }
+
+        nf_memcpy(m->comp_buf, b->code, b->size * sizeof(struct nf_instr));
+        m->comp_ip = m->comp_buf + b->size;
+        m->comp_str = 0;
+        m->src_next = src + b->len;
+
+        ++b->hits;
+        ++m->block_hits;
+
+        return 1;
+    }
+
+    m->block_src = src;
+    m->block_line = m->src_line;
+    m->block_strs = 0;
+    ++m->block_misses;
+
+    return 0;
+}
+
+/* called when a top-level block is compiled, cache it if it's on one line */
+void
+nf_block_store(struct nf_machine *m)
+{
+    struct nf_block *b = 0;
+    size_t len, size, need;
+    int i;
+
+    if (!m->block_src || m->block_line != m->src_line || !m->src_next ||
+        m->block_strs) {
+        return;
+    }
+
+    len = m->src_next - m->block_src;
+    size = m->comp_ip - m->comp_buf;
+    need = size * sizeof(struct nf_instr) + len + 1;
+
+    if (need > NF_BLOCK_STORAGE) {
+        m->block_src = 0;
+        return;
+    }
+
+    /* prefer a dropped entry, and otherwise replace them in turn */
+    for (i = 0; i < NF_BLOCK_CACHE_SIZE && !b; ++i) {
+        if (!m->blocks[i].src) {
+            b = &m->blocks[i];
+        }
+    }
+
+    if (!b) {
+        b = &m->blocks[m->block_pos++ % NF_BLOCK_CACHE_SIZE];
+    }
+
+    b->src = 0;
+
+    if (!b->cap) {
+        b->code = nf_malloc(NF_BLOCK_STORAGE);
+        if (!b->code) {
+            m->block_src = 0;
+            return;
+        }
+        b->cap = NF_BLOCK_STORAGE;
+    }
+
+    /* the text follows the bytecode, which keeps it aligned */
+    nf_memcpy(b->code, m->comp_buf, size * sizeof(struct nf_instr));
+    b->src = (char *)(b->code + size);
+    nf_memcpy(b->src, m->block_src, len);
+    b->src[len] = 0;
+
+    b->len = len;
+    b->size = size;
+    b->words = m->words;
+    b->hits = 0;
+
+    m->block_src = 0;
+}
+
+/* 'blocks.' ( -- ) print cached blocks, and how many times they were reused */
+static int
+nf_block_report(struct nf_machine *m)
+{
+    struct nf_block *b;
+    char buf[3 * sizeof(nf_clock_t) + 1];
+    char buf2[3 * sizeof(nf_clock_t) + 1];
+    int i;
+
+    nf_printf("%6s %6s  %s\n", "hits", "size", "source");
+
+    /* nf_printf may not support longs, see nf_prtf.c */
+    for (i = 0; i < NF_BLOCK_CACHE_SIZE; ++i) {
+        b = &m->blocks[i];
+
+        if (b->src) {
+            (void)nf_ultoa(b->hits, buf);
+            nf_printf("%6s %6u  %s\n", buf, (unsigned)b->size, b->src);
+        }
+    }
+
+    (void)nf_ultoa(m->block_hits, buf);
+    (void)nf_ultoa(m->block_misses, buf2);
+    nf_printf("%s hits, %s misses\n", buf, buf2);
+
+    return 0;
+}
+
+#define NF_DECL_PRIM(name, data) { name, NF_WORD_PRIM, data, 0 }
+
+/* append block cache words to the dictionary */
+void
+nf_define_block_words(struct nf_machine *m)
+{
+    static struct nf_word words[] = {
+        NF_DECL_PRIM("blocks.", (void*)nf_block_report),
+    };
+
+    int i, count;
+
+    count = sizeof(words) / sizeof(words[0]);
+
+    for (i = 0; i < count; ++i) {
+        nf_define_word(m, &words[i]);
+    }
+}
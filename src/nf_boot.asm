@@ -4,7 +4,7 @@
 ;
 
 ;
-; x86/nf_boot.asm - minimal bootloader for USB disks (no error handling)
+; x86/nf_boot.asm - minimal bootloader for USB disks and floppies
 ;
 
 [org 0x7c00]
@@ -12,117 +12,283 @@
 
 TARGET_SEGMENT  equ 0x1000
 TARGET_OFFSET   equ 0x100
-SECTOR_COUNT    equ 48
+LOAD_SEGMENT    equ 0x2000  ; Compressed payload is read here first
+LOAD_OFFSET     equ 0
+MIN_MATCH       equ 4       ; Shortest match, as in nf_mkimg.c
+START_LBA       equ 2       ; Sectors 0 and 1 hold copies of the boot sector
+MAX_RETRIES     equ 3
+IMAGE_HEADER    equ 0x1b0   ; Filled in by nf_mkimg
 
 
-    ; Setup segments and stack
+    ; Setup segments and stack. Variables are addressed through ds = 0,
+    ; the payload is written through es. The stack grows down from the
+    ; boot sector, outside of the segment being filled
     cli
-    mov ax, TARGET_SEGMENT
+    xor ax, ax
     mov ds, ax
-    mov es, ax
     mov ss, ax
-    mov sp, 0xffff
+    mov sp, 0x7c00
     sti
+    cld
 
     ; Preserve disk number
-    mov [cs:disk], dl
+    mov [disk], dl
 
-    ; Print intro string using BIOS teletype output
+    ; Print intro string
     mov si, intro
-.intro_loop:
-    mov al, [cs:si]
-    or al, al
-    jz .intro_done
-    mov ah, 0x0e
-    xor bx, bx
-    int 0x10
-    inc si
-    jmp .intro_loop
-.intro_done:
+    call print_str
 
 
-    ; Retrieve sectors per track
-    push es
+    ; Retrieve sectors per track and number of heads, keep the
+    ; defaults if the BIOS doesn't report the geometry
     mov ah, 0x08
-    mov dl, [cs:disk]
+    mov dl, [disk]
     int 0x13
+    jc .geometry_done
     and cl, 0x3f
-    mov [cs:spt], cl
-    pop es
-
-    ; Read data from floppy, one sector at a time, ignoring errors
-    mov si, SECTOR_COUNT
-    mov bx, TARGET_OFFSET
-    xor ch, ch              ; Cylinder 0
-    mov dl, [cs:disk]       ; Disk number
-    xor dh, dh              ; Head 0
-    mov cl, 3               ; Start sector (1-indexed)
-
-.read_loop:
-    ; Read one sector
-    mov ax, 0x0201
+    mov [spt], cl
+    inc dh
+    mov [heads], dh
+.geometry_done:
+
+    ; Use LBA reads if INT 13h extensions are available
+    mov ah, 0x41
+    mov bx, 0x55aa
+    mov dl, [disk]
     int 0x13
+    jc .lba_done
+    cmp bx, 0xaa55
+    jne .lba_done
+    test cl, 1
+    jz .lba_done
+    mov byte [use_lba], 1
+.lba_done:
 
-    call print_dot
 
-    ; Advance target buffer
-    add bx, 512
+    ; Read the packed payload in as few calls as possible
+    mov bp, [hdr_sectors]
+    or bp, bp
+    jz fail
+    mov es, [dap_segment]
 
-    ; Advance sector number
-    inc cl
-    cmp cl, [cs:spt]
-    jbe .read_next
+.read_loop:
+    mov di, MAX_RETRIES
+
+.read_retry:
+    ; Read up to 127 sectors, the limit of many BIOSes. The load area
+    ; starts at a 64 KB boundary and the packed payload is smaller than
+    ; 64 KB, so transfers never cross a DMA boundary
+    mov ax, 127
+    cmp ax, bp
+    jbe .count_done
+    mov ax, bp
+.count_done:
+    mov [dap_count], ax
+
+    ; Read, possibly fewer sectors if the track ends earlier
+    call read_sectors
+    jnc .read_ok
+
+    ; Reset the disk and retry
+    xor ax, ax
+    mov dl, [disk]
+    int 0x13
+    dec di
+    jnz .read_retry
+    jmp fail
 
-    ; Wrap to sector 1 and flip head
-    mov cl, 1
-    xor dh, 1
+.read_ok:
+    mov al, '.'
+    call print_char
+
+    ; Advance LBA, remaining count and target segment
+    mov ax, [dap_count]
+    add [dap_lba], ax
+    sub bp, ax
+    mov cl, 5
+    shl ax, cl
+    add [dap_segment], ax
+    mov es, [dap_segment]
+
+    or bp, bp
+    jnz .read_loop
 
-    ; If head is 0, advance cylinder
-    jnz .read_next
-    inc ch
 
-.read_next:
-    dec si
-    jnz .read_loop
+    ; Decompress the payload to its final location, see nf_mkimg.c
+    ; for the format of the compressed stream
+    mov bp, [hdr_length]
+    mov bx, bp
+    add bx, TARGET_OFFSET
+    mov dx, [hdr_sum]
+    mov ax, LOAD_SEGMENT
+    mov ds, ax
+    mov ax, TARGET_SEGMENT
+    mov es, ax
+    mov si, LOAD_OFFSET
+    mov di, TARGET_OFFSET
+    xor ch, ch
+.unpack_loop:
+    cmp di, bx
+    jae .unpack_done
+    lodsb
+    mov cl, al
+    and cl, 0x7f
+    test al, al
+    js .unpack_match
+
+    ; Copy a literal run
+    inc cx
+    rep movsb
+    jmp .unpack_loop
+
+.unpack_match:
+    ; Copy a match from the output written so far
+    add cl, MIN_MATCH
+    lodsw
+    push si
+    push ds
+    mov si, di
+    sub si, ax
+    push es
+    pop ds
+    rep movsb
+    pop ds
+    pop si
+    jmp .unpack_loop
+
+.unpack_done:
+
+    ; Verify the 16-bit sum of the payload words. nf_mkimg pads the
+    ; payload to an even length, so no byte past its end is summed
+    mov cx, bp
+    shr cx, 1
+    push es
+    pop ds
+    mov si, TARGET_OFFSET
+    xor bx, bx
+.sum_loop:
+    lodsw
+    add bx, ax
+    loop .sum_loop
+    cmp bx, dx
+    jne fail
 
 
     ; Save a known value to the beginning of the segment
     mov [0], word 0xcafe
 
+    ; Move the stack to the top of the COM segment, as DOS would. Loading
+    ; ss holds off interrupts until sp is loaded too
+    push es
+    pop ss
+    mov sp, 0xfffe
+
 
     ; Jump to the COM file
     jmp TARGET_SEGMENT:TARGET_OFFSET
 
 
-; Print a debugging dot to the screen
-print_dot:
-    push ax
-    push bx
-    push cx
-    push dx
+; Print an error message and halt
+fail:
+    push cs
+    pop ds
+    mov si, error
+    call print_str
+.halt:
+    hlt
+    jmp .halt
+
+
+; Read [dap_count] sectors from [dap_lba] to es:LOAD_OFFSET.
+; In CHS mode the count is limited to the end of the current track.
+; Return with CF set on error
+read_sectors:
+    mov dl, [disk]
+    cmp byte [use_lba], 0
+    je .chs
+
+    mov si, dap
+    mov ah, 0x42
+    int 0x13
+    ret
+
+.chs:
+    ; Split LBA into track and sector
+    mov ax, [dap_lba]
+    xor dx, dx
+    xor bh, bh
+    mov bl, [spt]
+    div bx
+    mov cx, dx
+
+    ; Limit count to the sectors left on this track
+    sub bl, dl
+    cmp bx, [dap_count]
+    jae .chs_count_done
+    mov [dap_count], bx
+.chs_count_done:
+
+    ; Split track into cylinder and head
+    inc cx
+    xor dx, dx
+    mov bl, [heads]
+    div bx
+    mov ch, al
+    mov dh, dl
+
+    mov dl, [disk]
+    mov bx, LOAD_OFFSET
+    mov al, [dap_count]
+    mov ah, 0x02
+    int 0x13
+    ret
+
+
+; Print a zero-terminated string from ds:si
+print_str:
+    lodsb
+    or al, al
+    jz .done
+    call print_char
+    jmp print_str
+.done:
+    ret
+
 
+; Print a single character using BIOS teletype output
+print_char:
     mov ah, 0x0e
-    mov al, '.'
     xor bx, bx
-    mov cx, 1
     int 0x10
-
-    pop dx
-    pop cx
-    pop bx
-    pop ax
-
     ret
 
 
-; Sectors per track (default 18, auto-detected at boot)
+; Disk address packet for INT 13h extensions
+dap:            db 0x10, 0
+dap_count:      dw 0
+dap_offset:     dw LOAD_OFFSET
+dap_segment:    dw LOAD_SEGMENT
+dap_lba:        dd START_LBA, 0
+
+; Sectors per track and heads (default 18 and 2, auto-detected at boot)
 spt: db 18
+heads: db 2
 
-; Disk number
+; Disk number and read mode
 disk: db 0
+use_lba: db 0
 
-; Intro text
+; Intro and error text
 intro: db 0x0d, 0x0a, "Booting NF [github.com/luke8086/nf]...", 0x00
+error: db " error", 0x00
+
+; Image header with packed payload length in sectors, unpacked
+; length in bytes and the sum of the unpacked payload words
+times IMAGE_HEADER - ($ - $$) db 0
+hdr_magic: db "NF"
+hdr_sectors: dw 0
+hdr_length: dw 0
+hdr_sum: dw 0
 
 ; MBR partition table with a single bootable partition
 times 0x1be - ($ - $$) db 0
@@ -17,8 +17,14 @@ enum {
     NF_WORD_MAX_WIDTH  = 31,
     NF_DATA_STACK_SIZE = 4096,
     NF_STMT_STACK_SIZE = 16,
+    NF_LOOP_STACK_SIZE = 16,
+    NF_LOCALS_SIZE     = 256,   /* cells, in all frames */
+    NF_LOCALS_MAX      = 8,     /* per word */
+    NF_INLINE_MAX      = 8,     /* instructions */
     NF_COMP_BUF_SIZE   = 2048,
-    NF_LINE_BUF_SIZE   = 1024
+    NF_LINE_BUF_SIZE   = 1024,
+    NF_BLOCK_CACHE_SIZE = 16,   /* top-level blocks */
+    NF_TRACE_SIZE      = 16     /* must be a power of 2 */
 };
 
 #if defined(__SIZE_TYPE__)
@@ -54,6 +60,31 @@ typedef int intmax_t;
 
 typedef intmax_t nf_cell_t;
 
+/* profiler clock ticks, see nf_clock */
+#if defined(NF_SUPPORTS_LONG_LONG)
+typedef unsigned long long nf_clock_t;
+#else
+typedef unsigned long nf_clock_t;
+#endif
+
+/* storage class of mutable globals, per thread in multithreaded builds */
+#ifndef NF_THREAD_LOCAL
+#define NF_THREAD_LOCAL
+#endif
+
+/* interrupt flags, atomic where other threads set them, see nf_irq.c */
+#ifdef NF_ATOMIC_IRQ
+#include <stdatomic.h>
+typedef atomic_int nf_irq_flag_t;
+#define NF_IRQ_LOAD(f)      atomic_load_explicit(&(f), memory_order_relaxed)
+#define NF_IRQ_STORE(f, v)  atomic_store_explicit(&(f), (v), \
+                                                  memory_order_relaxed)
+#else
+typedef volatile int nf_irq_flag_t;
+#define NF_IRQ_LOAD(f)      (f)
+#define NF_IRQ_STORE(f, v)  ((f) = (v))
+#endif
+
 /* interpreter tokens */
 
 enum nf_token_type {
@@ -78,7 +109,20 @@ enum nf_opcode {
     NF_OPCODE_LITERAL,
     NF_OPCODE_BRANCH,
     NF_OPCODE_BRANCH_IF,
-    NF_OPCODE_BRANCH_UNLESS
+    NF_OPCODE_BRANCH_UNLESS,
+    NF_OPCODE_DO,
+    NF_OPCODE_LOOP,
+    NF_OPCODE_PLUS_LOOP,
+    NF_OPCODE_LEAVE,
+    NF_OPCODE_LOOP_INDEX,
+    NF_OPCODE_FETCH,
+    NF_OPCODE_STORE,
+    NF_OPCODE_LOCALS,
+    NF_OPCODE_LOCAL_FETCH,
+    NF_OPCODE_LOCAL_STORE,
+    NF_OPCODE_TAILCALL,
+    NF_OPCODE_RECURSE,
+    NF_OPCODE_COUNT
 };
 
 struct nf_instr {
@@ -86,6 +130,14 @@ struct nf_instr {
     nf_cell_t value;
 };
 
+/* execution trace entry, recorded on every CALL */
+
+struct nf_trace {
+    struct nf_word *word;
+    int index;
+    nf_cell_t tos;
+};
+
 /* statement */
 
 enum nf_stmt_type {
@@ -97,7 +149,9 @@ enum nf_stmt_type {
     NF_STMT_BEGIN,
     NF_STMT_WHILE,
     NF_STMT_REPEAT,
-    NF_STMT_UNTIL
+    NF_STMT_UNTIL,
+    NF_STMT_DO,
+    NF_STMT_QUOT
 };
 
 struct nf_stmt {
@@ -105,16 +159,25 @@ struct nf_stmt {
     struct nf_instr *ip;
 };
 
+/* counted loop, see 'do' */
+
+struct nf_loop {
+    nf_cell_t index;
+    nf_cell_t limit;
+};
+
 /* word */
 
 struct nf_machine;
+struct nf_buf;
 typedef int (*nf_word_handler_t)(struct nf_machine *m);
 
 enum nf_word_type {
     NF_WORD_PRIM,
     NF_WORD_COMP,
     NF_WORD_STMT,
-    NF_WORD_VAR
+    NF_WORD_VAR,
+    NF_WORD_CONST
 };
 
 struct nf_word {
@@ -122,6 +185,41 @@ struct nf_word {
     enum nf_word_type type;
     void *data;
     struct nf_word *next;
+
+    /* operands of an operator without side effects, folded over literals */
+    int fold;
+
+    /* see nf_inln.c */
+    int noinline;
+    int inlined;
+
+    /* position in the dictionary, 0 outside of it, see nf_define_word */
+    unsigned id;
+
+#ifdef NF_OPSTAT
+    /* executed CALL instructions, see nf_opst.c */
+    unsigned long op_calls;
+#endif
+};
+
+/* profiler counters of a word, kept per machine, see nf_prof.c */
+
+struct nf_prof_count {
+    unsigned long calls;
+    nf_clock_t time_incl;
+    nf_clock_t time_excl;
+};
+
+/* bytecode of a top-level block, cached by its source, see nf_blkc.c */
+
+struct nf_block {
+    char *src;
+    size_t len;
+    struct nf_instr *code;
+    size_t size;
+    size_t cap;
+    struct nf_word *words;
+    unsigned long hits;
 };
 
 /* virtual machine */
@@ -135,10 +233,24 @@ enum nf_machine_state {
 struct nf_machine {
     int state;
     struct nf_word *words;
+    struct nf_word *shared_words;
 
     char line_buf[NF_LINE_BUF_SIZE];
     char *line_p;
 
+    /* position of the interpreter, see nf_intp_line */
+    char *src_next;
+    unsigned src_line;
+
+    /* top-level blocks, see nf_blkc.c */
+    struct nf_block blocks[NF_BLOCK_CACHE_SIZE];
+    char *block_src;
+    unsigned block_line;
+    unsigned block_pos;
+    int block_strs;
+    unsigned long block_hits;
+    unsigned long block_misses;
+
     int argc;
     char **argv;
 
@@ -147,9 +259,51 @@ struct nf_machine {
 
     struct nf_instr comp_buf[NF_COMP_BUF_SIZE];
     struct nf_instr *comp_ip;
+    struct nf_instr *comp_str;
+    struct nf_instr *comp_mark;
+
+    /* locals of the word being compiled */
+    char local_names[NF_LOCALS_MAX][NF_WORD_MAX_WIDTH + 1];
+    int local_count;
+    int local_decl;
+
+    /* quotations being compiled, see '[' */
+    int quot_depth;
 
     struct nf_stmt stmt_stack[NF_STMT_STACK_SIZE];
     struct nf_stmt *stmt_sp;
+
+    struct nf_loop loop_stack[NF_LOOP_STACK_SIZE];
+    struct nf_loop *loop_sp;
+
+    nf_cell_t local_stack[NF_LOCALS_SIZE];
+    nf_cell_t *local_sp;
+
+    /* buffers allocated by 'allot', see nf_mem.c */
+    struct nf_buf *bufs;
+
+#ifndef NF_NO_TRACE
+    struct nf_trace trace[NF_TRACE_SIZE];
+    unsigned trace_pos;
+#endif
+    int exec_depth;
+
+    nf_cell_t watchdog;
+    nf_clock_t watch_start;
+
+    size_t data_peak;
+    size_t stmt_peak;
+    size_t comp_peak;
+
+    int profile;
+    nf_clock_t prof_child;
+    struct nf_prof_count *prof_counts;
+    unsigned prof_size;
+
+#ifdef NF_OPSTAT
+    unsigned long op_count[NF_OPCODE_COUNT];
+    unsigned long op_pairs[NF_OPCODE_COUNT][NF_OPCODE_COUNT];
+#endif
 };
 
 /* macros */
@@ -165,20 +319,70 @@ struct nf_machine {
 /* nf_base.c */
 void nf_define_base_words(struct nf_machine *m);
 
+/* nf_blkc.c */
+void nf_block_reset(struct nf_machine *m);
+void nf_block_forget(struct nf_machine *m, char *name);
+int nf_block_find(struct nf_machine *m, char *name);
+void nf_block_store(struct nf_machine *m);
+void nf_define_block_words(struct nf_machine *m);
+
 /* nf_intp.c */
 int nf_intp_line(struct nf_machine *m, char *line);
+int nf_intp_text(struct nf_machine *m, const char *p, const char *end);
 
 /* nf_lex.c */
 char *nf_parse_token(char *src, struct nf_token *tok);
+int nf_parse_cell(char *src, nf_cell_t *num);
+
+/* nf_cpu.asm (nf_libc.c in hosted builds) */
+nf_clock_t nf_clock(void);
+void nf_ctx_switch(void *from, void *to);
+extern NF_THREAD_LOCAL nf_irq_flag_t nf_irq_pending;
+extern NF_THREAD_LOCAL nf_irq_flag_t nf_irq_break;
+void nf_irq_init(void);
+void nf_irq_done(void);
+void *nf_memcpy(void *dest, const void *src, size_t n);
+int nf_memcmp(const void *s1, const void *s2, size_t n);
+void *nf_memchr(const void *s, int c, size_t n);
+size_t nf_strlen(const char *s1);
+int nf_strcmp(const char *s1, const char *s2);
 
 /* nf_libc.c */
+nf_clock_t nf_clock_to_us(nf_clock_t t);
 void *nf_malloc(size_t size);
 void nf_free(void *ptr);
+size_t nf_heap_used(void);
+size_t nf_heap_free(void);
+void nf_stack_paint(void);
+size_t nf_stack_peak(void);
+void *nf_ctx_init(void *ctx, void (*entry)(void));
+void *nf_ctx_main(void);
 void nf_exit(char code);
 int nf_getx(void);
 void nf_putc(unsigned char c);
+void nf_write(const char *s, size_t n);
 int nf_printf(const char *format, ...);
 
+/* nf_opst.c */
+#ifdef NF_OPSTAT
+void nf_opstat_reset(struct nf_machine *m);
+void nf_opstat_count(struct nf_machine *m, int prev, struct nf_instr *i);
+void nf_define_opstat_words(struct nf_machine *m);
+#endif
+
+/* nf_prof.c */
+struct nf_prof_count *nf_prof_count(struct nf_machine *m, struct nf_word *w);
+void nf_define_prof_words(struct nf_machine *m);
+
+/* nf_stat.c */
+void nf_stat_reset(struct nf_machine *m);
+void nf_define_stat_words(struct nf_machine *m);
+
+/* nf_snap.c */
+char *nf_snap_create(struct nf_machine *m, const char *code, const char *end,
+                     size_t *len);
+int nf_snap_load(struct nf_machine *m, const char *snap, const char *end);
+
 /* nf_stmt.c */
 void nf_define_stmt_words(struct nf_machine *m);
 
@@ -196,10 +400,15 @@ struct nf_stmt *nf_stmt_get(struct nf_machine *m, size_t n);
 
 void nf_comp_start(struct nf_machine *m);
 void nf_comp_finish(struct nf_machine *m);
+struct nf_instr *nf_comp_quot(struct nf_machine *m, struct nf_instr *start);
+int nf_comp_local(struct nf_machine *m, char *name);
+int nf_comp_fold(struct nf_machine *m, struct nf_word *w);
 struct nf_instr *nf_comp_instr(struct nf_machine *m, nf_cell_t opcode,
                                nf_cell_t value);
 
+void nf_reset_machine(struct nf_machine *m);
 struct nf_machine *nf_init_machine(int argc, char **argv);
+struct nf_machine *nf_fork_machine(struct nf_machine *base);
 
 /* nf_prtf.c */
 int nf_asnprintf(char *buf, size_t nbyte, const char *fmt,
@@ -208,16 +417,45 @@ int nf_vsnprintf(char *buf, size_t nbyte, const char *fmt,
                  va_list va);
 
 /* nf_str.c */
-void *nf_memcpy(void *dest, const void *src, size_t n);
-size_t nf_strlen(const char *s1);
-int nf_strcmp(const char *s1, const char *s2);
 char *nf_strncpy(char *dest, const char *src, size_t n);
+char *nf_strstr(const char *s1, const char *s2);
+size_t nf_ultoa(nf_clock_t n, char *buf);
+size_t nf_itoa(nf_cell_t n, char *buf);
+void nf_define_str_words(struct nf_machine *m);
+
+/* nf_task.c */
+int nf_task_count(void);
+void nf_task_yield(void);
+void nf_task_reset(void);
+void nf_define_task_words(struct nf_machine *m);
+
+/* nf_irq.c */
+int nf_irq_handle(struct nf_machine *m);
+void nf_define_irq_words(struct nf_machine *m);
+
+/* nf_inln.c */
+int nf_inline_word(struct nf_machine *m, struct nf_word *w);
+void nf_define_inline_words(struct nf_machine *m);
+
+/* nf_mem.c */
+int nf_mem_check(struct nf_machine *m, nf_cell_t addr, nf_cell_t n);
+unsigned char *nf_mem_allot(struct nf_machine *m, nf_cell_t n);
+void nf_define_mem_words(struct nf_machine *m);
+
+/* nf_trce.c */
+#ifndef NF_NO_TRACE
+void nf_trace_dump(struct nf_machine *m);
+void nf_define_trace_words(struct nf_machine *m);
+#endif
 
 /* nf_word.c */
 struct nf_word *nf_init_word(struct nf_machine *m, char *name,
                              enum nf_word_type type, void *data);
+struct nf_word *nf_init_var(struct nf_machine *m, char *name, nf_cell_t val);
 void nf_define_word(struct nf_machine *m, struct nf_word *w);
 struct nf_word *nf_lookup_word(struct nf_machine *m, char *name);
+int nf_word_is_shared(struct nf_machine *m, struct nf_word *w);
+nf_cell_t *nf_var_cell(struct nf_machine *m, char *name);
 int nf_call_word(struct nf_machine *m, struct nf_word *w);
 
 #endif /* _NF_CMMN_H_ */
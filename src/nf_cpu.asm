@@ -68,6 +68,35 @@ intr_int:
     ret
 
 
+; void nf_ctx_switch(struct nf_ctx *from, struct nf_ctx *to);
+; save registers preserved by the calling convention on the current stack,
+; store the stack pointer in from->sp, and resume the stack saved in to->sp
+global nf_ctx_switch
+nf_ctx_switch:
+    push bp
+    mov bp, sp
+    push si
+    push di
+
+    mov bx, [bp+6]
+    mov ax, [bx]
+    mov bx, [bp+4]
+    mov [bx], sp
+    mov sp, ax
+
+    pop di
+    pop si
+    pop bp
+    ret
+
+
+; unsigned nf_get_sp(void);
+global nf_get_sp
+nf_get_sp:
+    mov ax, sp
+    ret
+
+
 ; void nf_reboot(void);
 global nf_reboot
 nf_reboot:
@@ -75,3 +104,308 @@ nf_reboot:
     mov al, 0xfe
     out 0x64, al
     hlt
+
+
+; void nf_clock_init(void);
+; switch PIT channel 0 to mode 2 (rate generator) with the default period,
+; so that its counter decreases linearly between timer interrupts
+global nf_clock_init
+nf_clock_init:
+    pushf
+    cli
+    mov al, 0x34
+    out 0x43, al
+    xor al, al
+    out 0x40, al
+    out 0x40, al
+    popf
+    ret
+
+
+; unsigned long nf_clock(void);
+; return time in PIT ticks (1193182 Hz), made of the low word of the BIOS
+; tick count at 0040:006C and the elapsed part of the PIT counter. the CPU
+; is 8086, so RDTSC is not an option
+global nf_clock
+nf_clock:
+    push ds
+    mov ax, 0x40
+    mov ds, ax
+
+.retry:
+    mov dx, [0x6c]
+
+    ; latch and read the counter of channel 0
+    pushf
+    cli
+    xor al, al
+    out 0x43, al
+    in al, 0x40
+    mov ah, al
+    in al, 0x40
+    xchg al, ah
+    popf
+
+    ; read again if a timer interrupt came in between
+    cmp dx, [0x6c]
+    jne .retry
+
+    ; the counter goes down from 65536 (read as 0) to 1
+    neg ax
+
+    pop ds
+    ret
+
+
+; flags set by the interrupt handlers below, see nf_irq.c. they live in
+; the code segment, since ds is unknown when an interrupt arrives
+global nf_irq_pending
+global nf_irq_break
+nf_irq_pending: dw 0
+nf_irq_break:   dw 0
+
+; vectors replaced by nf_irq_init, restored by nf_irq_done
+irq_old_08: dd 0
+irq_old_1b: dd 0
+
+
+; INT 08h, timer tick (18.2 Hz): request a task switch and chain to BIOS
+irq_timer:
+    mov word [cs:nf_irq_pending], 1
+    jmp far [cs:irq_old_08]
+
+
+; INT 1Bh, Ctrl-Break: request an abort. not chained, so that DOS
+; doesn't terminate the interpreter
+irq_ctrl_break:
+    mov word [cs:nf_irq_break], 1
+    mov word [cs:nf_irq_pending], 1
+    iret
+
+
+; void nf_irq_init(void);
+global nf_irq_init
+nf_irq_init:
+    push es
+    xor ax, ax
+    mov es, ax
+
+    pushf
+    cli
+
+    mov ax, [es:0x08*4]
+    mov [irq_old_08], ax
+    mov ax, [es:0x08*4+2]
+    mov [irq_old_08+2], ax
+    mov word [es:0x08*4], irq_timer
+    mov [es:0x08*4+2], cs
+
+    mov ax, [es:0x1b*4]
+    mov [irq_old_1b], ax
+    mov ax, [es:0x1b*4+2]
+    mov [irq_old_1b+2], ax
+    mov word [es:0x1b*4], irq_ctrl_break
+    mov [es:0x1b*4+2], cs
+
+    popf
+    pop es
+    ret
+
+
+; void nf_irq_done(void);
+; restore the original vectors, must be called before returning to DOS
+global nf_irq_done
+nf_irq_done:
+    ; nothing to do if nf_irq_init wasn't called
+    mov ax, [irq_old_08+2]
+    or ax, ax
+    jz .done
+
+    push es
+    xor ax, ax
+    mov es, ax
+
+    pushf
+    cli
+
+    mov ax, [irq_old_08]
+    mov [es:0x08*4], ax
+    mov ax, [irq_old_08+2]
+    mov [es:0x08*4+2], ax
+
+    mov ax, [irq_old_1b]
+    mov [es:0x1b*4], ax
+    mov ax, [irq_old_1b+2]
+    mov [es:0x1b*4+2], ax
+
+    mov word [irq_old_08+2], 0
+
+    popf
+    pop es
+
+.done:
+    ret
+
+
+; the string functions below use the string instructions, which take es:di
+; as the destination. es is set to ds, which is the same in the tiny model,
+; but may differ while in an interrupt handler
+
+; void *nf_memcpy(void *dest, const void *src, size_t n);
+; copy words, and the odd byte left, if any
+global nf_memcpy
+nf_memcpy:
+    push bp
+    mov bp, sp
+    push si
+    push di
+    push es
+    push ds
+    pop es
+    cld
+
+    mov di, [bp+4]
+    mov si, [bp+6]
+    mov cx, [bp+8]
+    shr cx, 1
+    rep movsw
+    adc cx, cx
+    rep movsb
+
+    mov ax, [bp+4]
+
+    pop es
+    pop di
+    pop si
+    pop bp
+    ret
+
+
+; int nf_memcmp(const void *s1, const void *s2, size_t n);
+global nf_memcmp
+nf_memcmp:
+    push bp
+    mov bp, sp
+    push si
+    push di
+    push es
+    push ds
+    pop es
+    cld
+
+    mov si, [bp+4]
+    mov di, [bp+6]
+    mov cx, [bp+8]
+    xor ax, ax
+    jcxz .done
+
+    repe cmpsb
+    je .done
+
+    ; difference of the first mismatching bytes, as unsigned chars
+    mov al, [si-1]
+    mov dl, [di-1]
+    xor dh, dh
+    sub ax, dx
+
+.done:
+    pop es
+    pop di
+    pop si
+    pop bp
+    ret
+
+
+; void *nf_memchr(const void *s, int c, size_t n);
+global nf_memchr
+nf_memchr:
+    push bp
+    mov bp, sp
+    push di
+    push es
+    push ds
+    pop es
+    cld
+
+    mov di, [bp+4]
+    mov al, [bp+6]
+    mov cx, [bp+8]
+    jcxz .none
+
+    repne scasb
+    jne .none
+
+    lea ax, [di-1]
+    jmp .done
+
+.none:
+    xor ax, ax
+
+.done:
+    pop es
+    pop di
+    pop bp
+    ret
+
+
+; size_t nf_strlen(const char *s1);
+global nf_strlen
+nf_strlen:
+    push bp
+    mov bp, sp
+    push di
+    push es
+    push ds
+    pop es
+    cld
+
+    mov di, [bp+4]
+    xor al, al
+    mov cx, 0xffff
+    repne scasb
+
+    ; cx was decremented once per character and once for the terminator
+    mov ax, 0xfffe
+    sub ax, cx
+
+    pop es
+    pop di
+    pop bp
+    ret
+
+
+; int nf_strcmp(const char *s1, const char *s2);
+; find the length of s1 first, then compare up to and including its
+; terminator, so that the comparison stops at the end of either string
+global nf_strcmp
+nf_strcmp:
+    push bp
+    mov bp, sp
+    push si
+    push di
+    push es
+    push ds
+    pop es
+    cld
+
+    mov di, [bp+4]
+    xor al, al
+    mov cx, 0xffff
+    repne scasb
+    not cx
+
+    mov si, [bp+4]
+    mov di, [bp+6]
+    repe cmpsb
+
+    xor ah, ah
+    mov al, [si-1]
+    mov dl, [di-1]
+    xor dh, dh
+    sub ax, dx
+
+    pop es
+    pop di
+    pop si
+    pop bp
+    ret
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 luke8086.
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * nf_inln.c - inlining of small compiled words
+ *
+ * When compiled code refers to a compiled word of at most NF_INLINE_MAX
+ * instructions, its body is copied in place of the CALL instruction,
+ * without the final RETURN. Branch offsets are relative, so the copy
+ * works as is. Inlined bodies are already inlined themselves, so the
+ * threshold also bounds the growth of nested definitions.
+ *
+ * Operators in straight-line bodies are folded with the literals before
+ * them, see nf_comp_fold.
+ *
+ * Words with locals or calling themselves are still called, as they need
+ * a frame of their own.
+ * So are words marked with 'noinline', and all words while the profiler
+ * is on, to keep them in its report.
+ */
+
+#include "nf_cmmn.h"
+
+/* local functions */
+static int nf_inline_size(struct nf_word *w);
+static int nf_inline_jumps(struct nf_instr *i, int n);
+
+/* return the body size of a compiled word, or -1 if it can't be inlined */
+static int
+nf_inline_size(struct nf_word *w)
+{
+    struct nf_instr *i = w->data;
+    int n;
+
+    for (n = 0; n <= NF_INLINE_MAX; ++n, ++i) {
+        if (i->opcode == NF_OPCODE_RETURN) {
+            return n;
+        }
+
+        /* locals and recursion need a call */
+        if (i->opcode == NF_OPCODE_LOCALS || i->opcode == NF_OPCODE_RECURSE ||
+            (i->opcode == NF_OPCODE_CALL && i->value == (nf_cell_t)w)) {
+            return -1;
+        }
+    }
+
+    return -1;
+}
+
+/* check if n instructions at i contain anything but straight-line code */
+static int
+nf_inline_jumps(struct nf_instr *i, int n)
+{
+    for (; n; --n, ++i) {
+        if (i->opcode != NF_OPCODE_LITERAL && i->opcode != NF_OPCODE_CALL &&
+            i->opcode != NF_OPCODE_TAILCALL && i->opcode != NF_OPCODE_FETCH &&
+            i->opcode != NF_OPCODE_STORE) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/* compile the body of w in place of a call. return 0 if it's not inlined */
+int
+nf_inline_word(struct nf_machine *m, struct nf_word *w)
+{
+    struct nf_instr *i;
+    int n, op, jumps;
+
+    if (w->type != NF_WORD_COMP || w->noinline || m->profile) {
+        return 0;
+    }
+
+    n = nf_inline_size(w);
+
+    /* leave reporting an overflow to the CALL */
+    if (n < 0 || m->comp_ip - m->comp_buf > NF_COMP_BUF_SIZE - n) {
+        return 0;
+    }
+
+    jumps = nf_inline_jumps(w->data, n);
+
+    for (i = w->data; n; --n, ++i) {
+        /* a tail call would skip the rest of the caller */
+        op = (i->opcode == NF_OPCODE_TAILCALL) ? NF_OPCODE_CALL : i->opcode;
+
+        /* straight-line code can be folded with the literals before it */
+        if (!jumps && op == NF_OPCODE_CALL &&
+            nf_comp_fold(m, (struct nf_word *)i->value)) {
+            continue;
+        }
+
+        nf_comp_instr(m, op, i->value);
+    }
+
+    /* branches of the copy may point past it */
+    if (jumps) {
+        m->comp_mark = m->comp_ip;
+    }
+
+    /* shared words are read-only */
+    if (!nf_word_is_shared(m, w)) {
+        w->inlined++;
+    }
+
+    return 1;
+}
+
+/* 'noinline' ( s -- ) always call the word named s */
+static int
+nf_inline_never(struct nf_machine *m)
+{
+    struct nf_word *w;
+
+    if (nf_data_check(m, 1, 0))
+        return -1;
+
+    w = nf_lookup_word(m, (char *)nf_data_pop(m));
+    if (!w) {
+        nf_error(("unknown word"));
+        return -1;
+    }
+
+    if (nf_word_is_shared(m, w)) {
+        nf_error(("read-only word"));
+        return -1;
+    }
+
+    w->noinline = 1;
+
+    /* cached blocks may have inlined it */
+    nf_block_forget(m, w->name);
+
+    return 0;
+}
+
+/* 'inline.' ( -- ) print words which were inlined, and how many times */
+static int
+nf_inline_report(struct nf_machine *m)
+{
+    struct nf_word *w;
+
+    nf_printf("%-16s %6s %6s\n", "word", "size", "sites");
+
+    for (w = m->words; w; w = w->next) {
+        if (w->inlined) {
+            nf_printf("%-16s %6d %6d\n", w->name, nf_inline_size(w),
+                      w->inlined);
+        }
+    }
+
+    return 0;
+}
+
+#define NF_DECL_PRIM(name, data) { name, NF_WORD_PRIM, data, 0 }
+
+/* append inlining words to the dictionary */
+void
+nf_define_inline_words(struct nf_machine *m)
+{
+    static struct nf_word words[] = {
+        NF_DECL_PRIM("noinline", (void*)nf_inline_never),
+        NF_DECL_PRIM("inline.",  (void*)nf_inline_report),
+    };
+
+    int i, count;
+
+    count = sizeof(words) / sizeof(words[0]);
+
+    for (i = 0; i < count; ++i) {
+        nf_define_word(m, &words[i]);
+    }
+}
@@ -13,6 +13,7 @@
 static int nf_intp_string(struct nf_machine *m, struct nf_token *t);
 static int nf_intp_number(struct nf_machine *m, struct nf_token *t);
 static int nf_intp_word(struct nf_machine *m, struct nf_token *t);
+static int nf_intp_local(struct nf_machine *m, struct nf_token *t);
 static int nf_intp_token(struct nf_machine *m, struct nf_token *t);
 
 /* interpret string token */
@@ -41,7 +42,11 @@ nf_intp_string(struct nf_machine *m, struct nf_token *t)
     /* in compilation mode, compile heap address as a literal */
     } else {
 
-        if (!nf_comp_instr(m, NF_OPCODE_LITERAL, (nf_cell_t)p)) {
+        /* each evaluation of a block needs its own copy, see nf_blkc.c */
+        ++m->block_strs;
+
+        m->comp_str = nf_comp_instr(m, NF_OPCODE_LITERAL, (nf_cell_t)p);
+        if (!m->comp_str) {
             nf_error(("compilation buffer overflow"));
             return -1;
         }
@@ -78,7 +83,29 @@ nf_intp_number(struct nf_machine *m, struct nf_token *t)
 static int
 nf_intp_word(struct nf_machine *m, struct nf_token *t)
 {
-    struct nf_word *p = nf_lookup_word(m, t->str);
+    struct nf_word *p;
+    nf_cell_t *cell;
+    int local;
+
+    /* locals of the word being compiled hide other words */
+    if (m->state == NF_STATE_COMPILE &&
+        (local = nf_comp_local(m, t->str)) >= 0) {
+
+        /* quotations run in a frame of their own */
+        if (m->quot_depth) {
+            nf_error(("local in quotation"));
+            return -1;
+        }
+
+        if (!nf_comp_instr(m, NF_OPCODE_LOCAL_FETCH, local)) {
+            nf_error(("compilation buffer overflow"));
+            return -1;
+        }
+
+        return 0;
+    }
+
+    p = nf_lookup_word(m, t->str);
 
     if (!p) {
         nf_error(("unknown word"));
@@ -92,8 +119,34 @@ nf_intp_word(struct nf_machine *m, struct nf_token *t)
             return -1;
         }
 
-    /* in compilation mode, compile CALL instruction */
-    } else {
+        /* statements may refer to the code compiled so far */
+        if (p->type == NF_WORD_STMT) {
+            m->comp_mark = m->comp_ip;
+        }
+
+    /* in compilation mode, compile constants as literals */
+    } else if (p->type == NF_WORD_CONST) {
+
+        if (!nf_comp_instr(m, NF_OPCODE_LITERAL, *(nf_cell_t *)p->data)) {
+            nf_error(("compilation buffer overflow"));
+            return -1;
+        }
+
+    /* in compilation mode, compile variables as a direct fetch */
+    } else if (p->type == NF_WORD_VAR) {
+
+        cell = nf_var_cell(m, p->name);
+        if (!cell) {
+            return -1;
+        }
+
+        if (!nf_comp_instr(m, NF_OPCODE_FETCH, (nf_cell_t)cell)) {
+            nf_error(("compilation buffer overflow"));
+            return -1;
+        }
+
+    /* and other words as a CALL, unless they're folded or inlined */
+    } else if (!nf_comp_fold(m, p) && !nf_inline_word(m, p)) {
 
         if (!nf_comp_instr(m, NF_OPCODE_CALL, (nf_cell_t)p)) {
             nf_error(("compilation buffer overflow"));
@@ -105,10 +158,52 @@ nf_intp_word(struct nf_machine *m, struct nf_token *t)
     return 0;
 }
 
+/* declare a local between '{' and '}' */
+static int
+nf_intp_local(struct nf_machine *m, struct nf_token *t)
+{
+    if (t->type != NF_TOKEN_WORD) {
+        nf_error(("syntax error"));
+        return -1;
+    }
+
+    if (!nf_strcmp(t->str, "}")) {
+        m->local_decl = 0;
+
+        if (m->local_count &&
+            !nf_comp_instr(m, NF_OPCODE_LOCALS, m->local_count)) {
+            nf_error(("compilation buffer overflow"));
+            return -1;
+        }
+
+        return 0;
+    }
+
+    if (m->local_count >= NF_LOCALS_MAX) {
+        nf_error(("too many locals"));
+        return -1;
+    }
+
+    if (nf_strlen(t->str) > NF_WORD_MAX_WIDTH) {
+        nf_error(("name too long"));
+        return -1;
+    }
+
+    nf_strncpy(m->local_names[m->local_count++], t->str,
+               NF_WORD_MAX_WIDTH + 1);
+
+    return 0;
+}
+
 /* interpret a single token. return 0 on success. */
 static int
 nf_intp_token(struct nf_machine *m, struct nf_token *t)
 {
+    /* between '{' and '}', tokens declare locals */
+    if (m->local_decl && t->type != NF_TOKEN_EMPTY) {
+        return nf_intp_local(m, t);
+    }
+
     switch(t->type) {
 
     case NF_TOKEN_EMPTY:
@@ -138,15 +233,55 @@ int
 nf_intp_line(struct nf_machine *m, char *line)
 {
     struct nf_token token, *t;
+    char *next = m->src_next;
+    int ret = 0;
 
     t = &token;
 
+    /* lines are numbered, so that a span of text can't outlive its line */
+    ++m->src_line;
+
+    /* words may move src_next past the text they consumed, see nf_blkc.c */
     while (line) {
-        line = nf_parse_token(line, t);
-        if (nf_intp_token(m, t))
-            return -1;
+        m->src_next = nf_parse_token(line, t);
+        if (nf_intp_token(m, t)) {
+            ret = -1;
+            break;
+        }
+        line = m->src_next;
     }
 
-    return 0;
+    m->src_next = next;
+    ++m->src_line;
+
+    return ret;
 }
 
+/* interpret a buffer of code line by line. return 0 if all lines succeeded */
+int
+nf_intp_text(struct nf_machine *m, const char *p, const char *end)
+{
+    char buf[NF_LINE_BUF_SIZE];
+    int i, ret = 0;
+
+    while (p < end) {
+        /* copy one line into buf */
+        i = 0;
+        while (p < end && *p != '\n' && *p != '\r' && i < NF_LINE_BUF_SIZE - 1) {
+            buf[i++] = *p++;
+        }
+        buf[i] = '\0';
+
+        /* skip line endings */
+        while (p < end && (*p == '\r' || *p == '\n')) {
+            ++p;
+        }
+
+        /* interpret the line */
+        if (i > 0 && nf_intp_line(m, buf)) {
+            ret = -1;
+        }
+    }
+
+    return ret;
+}
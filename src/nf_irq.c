@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 luke8086.
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * nf_irq.c - timer and break interrupts
+ *
+ * The timer and Ctrl-Break interrupt handlers of the platform (signals in
+ * hosted builds) only set nf_irq_pending, which nf_exec tests before every
+ * call and branch. Everything else happens here, in the interpreter: the
+ * running task gives up its time slice, the watchdog aborts words running
+ * longer than allowed, and a break aborts the running word, leaving the
+ * data stack as it was.
+ */
+
+#include "nf_cmmn.h"
+
+/* handle pending interrupts, return -1 if execution should be aborted */
+int
+nf_irq_handle(struct nf_machine *m)
+{
+    nf_clock_t ms;
+
+    /* clear it first, so that an interrupt arriving now is not lost */
+    NF_IRQ_STORE(nf_irq_pending, 0);
+
+    if (NF_IRQ_LOAD(nf_irq_break)) {
+        NF_IRQ_STORE(nf_irq_break, 0);
+        nf_error(("break"));
+        return -1;
+    }
+
+    if (m->watchdog) {
+        ms = nf_clock_to_us(nf_clock() - m->watch_start) / 1000;
+
+        if (ms >= (nf_clock_t)m->watchdog) {
+            nf_error(("watchdog: %ld ms exceeded", m->watchdog));
+            return -1;
+        }
+    }
+
+    nf_task_yield();
+
+    return 0;
+}
+
+/* 'watchdog' ( n -- ) abort words running longer than n ms, 0 disables */
+static int
+nf_irq_watchdog(struct nf_machine *m)
+{
+    nf_cell_t n;
+
+    if (nf_data_check(m, 1, 0))
+        return -1;
+
+    n = nf_data_pop(m);
+
+    if (n < 0) {
+        nf_error(("invalid budget"));
+        return -1;
+    }
+
+    m->watchdog = n;
+
+    return 0;
+}
+
+#define NF_DECL_PRIM(name, data) { name, NF_WORD_PRIM, data, 0 }
+
+/* append interrupt words to the dictionary */
+void
+nf_define_irq_words(struct nf_machine *m)
+{
+    static struct nf_word words[] = {
+        NF_DECL_PRIM("watchdog", (void*)nf_irq_watchdog),
+    };
+
+    int i, count;
+
+    count = sizeof(words) / sizeof(words[0]);
+
+    for (i = 0; i < count; ++i) {
+        nf_define_word(m, &words[i]);
+    }
+}
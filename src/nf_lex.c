@@ -21,6 +21,7 @@ static char *nf_parse_escape_seq(char *src, char *dst);
 static int nf_match_string(char *src);
 static char *nf_parse_string(char *src, struct nf_token *tok);
 static int nf_match_number(char *src);
+static char *nf_scan_number(char *src, nf_cell_t *num);
 static char *nf_parse_number(char *src, struct nf_token *tok);
 static char *nf_parse_word(char *src, struct nf_token *tok);
 static int nf_match_comment(char *src);
@@ -231,18 +232,17 @@ nf_match_number(char *src)
 }
 
 /*
- * parse number from src and store in tok
+ * scan number from src and store in num
  * return address of the first non-consumed character or 0 on error
  */
 static char *
-nf_parse_number(char *src, struct nf_token *tok)
+nf_scan_number(char *src, nf_cell_t *num)
 {
     int mul;
     int base;
     char *s = src;
 
-    tok->type = NF_TOKEN_NUMBER;
-    tok->num = 0;
+    *num = 0;
 
     /* - sign */
     if (s[0] == '-') {
@@ -271,7 +271,6 @@ nf_parse_number(char *src, struct nf_token *tok)
     }
     /* octal prefix with non octal character */
     else if (s[0] == '0' && s[1] && !nf_is_delim(s[1])) {
-        tok->type = NF_TOKEN_INVALID;
         return 0;
     }
     /* no prefix */
@@ -283,34 +282,33 @@ nf_parse_number(char *src, struct nf_token *tok)
 
         /* null-terminator or delimiter */
         if (s[0] == 0 || nf_is_delim(s[0])) {
-            tok->num *= mul;
+            *num *= mul;
             return s;
         }
 
         /* base 10 and dec digit */
         else if (base == 10 && nf_is_dec(s[0])) {
-            tok->num = tok->num * base + nf_dec_to_int(s[0]);
+            *num = *num * base + nf_dec_to_int(s[0]);
             s += 1;
             continue;
         }
 
         /* base 8 and oct digit */
         else if (base == 8 && nf_is_oct(s[0])) {
-            tok->num = tok->num * base + nf_oct_to_int(s[0]);
+            *num = *num * base + nf_oct_to_int(s[0]);
             s += 1;
             continue;
         }
 
         /* base 16 and hex digit */
         else if (base == 16 && nf_is_hex(s[0])) {
-            tok->num = tok->num * base + nf_hex_to_int(s[0]);
+            *num = *num * base + nf_hex_to_int(s[0]);
             s += 1;
             continue;
         }
 
         /* invalid character */
         else {
-            tok->type = NF_TOKEN_INVALID;
             return 0;
         }
 
@@ -319,6 +317,19 @@ nf_parse_number(char *src, struct nf_token *tok)
     /* NOTREACHED */
 }
 
+/*
+ * parse number from src and store in tok
+ * return address of the first non-consumed character or 0 on error
+ */
+static char *
+nf_parse_number(char *src, struct nf_token *tok)
+{
+    src = nf_scan_number(src, &tok->num);
+    tok->type = src ? NF_TOKEN_NUMBER : NF_TOKEN_INVALID;
+
+    return src;
+}
+
 /*
  * parse word from src and store in tok
  * return address of the first non-consumed character or 0 on error
@@ -443,3 +454,18 @@ nf_parse_token(char *src, struct nf_token *tok)
 
     /* NOTREACHED */
 }
+
+/*
+ * parse a whole string as a number and store in num
+ * return 0 on success or -1 if it's not a valid number
+ */
+int
+nf_parse_cell(char *src, nf_cell_t *num)
+{
+    if (!nf_match_number(src))
+        return -1;
+
+    src = nf_scan_number(src, num);
+
+    return (src && !src[0]) ? 0 : -1;
+}
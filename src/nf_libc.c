@@ -21,18 +21,77 @@ void nf_reboot(void);
 extern void *nf_heap_start;
 static char *nf_heap_ptr = (char *)&nf_heap_start;
 
+/*
+ * the C stack grows down from nf_stack_start (from nf_strt.asm) towards
+ * the heap. nf_malloc keeps NF_STACK_RESERVE bytes free below the current
+ * stack pointer, and the free memory is painted to find the stack peak.
+ */
+#define NF_STACK_RESERVE 1024
+#define NF_STACK_PAINT   0x5a
+
+extern unsigned nf_stack_start;
+unsigned nf_get_sp(void);
+
+/*
+ * task context, i.e. the saved stack pointer, followed by the stack.
+ * see nf_ctx_switch in nf_cpu.asm for the layout of a suspended stack
+ */
+#define NF_TASK_STACK_SIZE 3072
+
+struct nf_ctx {
+    unsigned sp;
+};
+
+static struct nf_ctx nf_ctx_console;
+
 /* buffer for nf_readline */
 #define NF_READLINE_BUF_SIZE 64
 static char nf_readline_buf[NF_READLINE_BUF_SIZE];
 
+/* command line arguments */
+#define NF_MAX_ARGS 8
+static char *nf_args[NF_MAX_ARGS + 1];
+
 /* local functions */
+static int nf_is_dos(void);
+static char *nf_stack_limit(void);
 static void nf_puts(char *);
 
-/* allocate chunk of memory on the heap */
+/* check if running as a DOS program, by looking for INT 20h at the start of PSP */
+static int
+nf_is_dos(void)
+{
+    return *((unsigned *)0) == 0x20CD;
+}
+
+/* convert nf_clock ticks (1193182 Hz) to microseconds */
+nf_clock_t
+nf_clock_to_us(nf_clock_t t)
+{
+    return t / 1193 * 1000 + t % 1193 * 1000 / 1193;
+}
+
+/* return the lowest address of the console stack */
+static char *
+nf_stack_limit(void)
+{
+    char *sp = (char *)nf_get_sp();
+
+    /* task stacks are allocated on the heap, below nf_heap_ptr */
+    return (sp > nf_heap_ptr) ? sp : (char *)nf_ctx_console.sp;
+}
+
+/* allocate chunk of memory on the heap. return 0 if it would reach the stack */
 void *
 nf_malloc(size_t size)
 {
     void *ret = (void *)nf_heap_ptr;
+    size_t avail = nf_stack_limit() - nf_heap_ptr;
+
+    if (avail < NF_STACK_RESERVE || size > avail - NF_STACK_RESERVE) {
+        return 0;
+    }
+
     nf_heap_ptr += size;
     return ret;
 }
@@ -44,6 +103,85 @@ nf_free(void *ptr)
     (void)ptr;
 }
 
+/* return amount of memory allocated on the heap */
+size_t
+nf_heap_used(void)
+{
+    return nf_heap_ptr - (char *)&nf_heap_start;
+}
+
+/* return amount of memory which can still be allocated */
+size_t
+nf_heap_free(void)
+{
+    size_t avail = nf_stack_limit() - nf_heap_ptr;
+    return avail > NF_STACK_RESERVE ? avail - NF_STACK_RESERVE : 0;
+}
+
+/* paint the free memory between the heap and the current stack frames */
+void
+nf_stack_paint(void)
+{
+    char *p = nf_heap_ptr;
+    char *end = nf_stack_limit() - 64;
+
+    while (p < end) {
+        *p++ = NF_STACK_PAINT;
+    }
+}
+
+/* return the deepest C stack usage since painting, or -1 if it reached the heap */
+size_t
+nf_stack_peak(void)
+{
+    char *p = nf_heap_ptr;
+    char *end = nf_stack_limit();
+
+    if (*p != NF_STACK_PAINT) {
+        return (size_t)-1;
+    }
+
+    while (p < end && *p == NF_STACK_PAINT) {
+        ++p;
+    }
+
+    return (char *)nf_stack_start - p;
+}
+
+/* prepare ctx, or a new context if 0, to run entry on its own stack */
+void *
+nf_ctx_init(void *ctx, void (*entry)(void))
+{
+    struct nf_ctx *c = ctx;
+    unsigned *sp;
+
+    if (!c) {
+        c = nf_malloc(sizeof(struct nf_ctx) + NF_TASK_STACK_SIZE);
+        if (!c) {
+            return 0;
+        }
+    }
+
+    sp = (unsigned *)((char *)(c + 1) + NF_TASK_STACK_SIZE);
+
+    *--sp = 0;                  /* return address of entry, never used */
+    *--sp = (unsigned)entry;    /* return address of nf_ctx_switch */
+    *--sp = 0;                  /* bp */
+    *--sp = 0;                  /* si */
+    *--sp = 0;                  /* di */
+
+    c->sp = (unsigned)sp;
+
+    return c;
+}
+
+/* return context of the console, saved when switching to a task */
+void *
+nf_ctx_main(void)
+{
+    return &nf_ctx_console;
+}
+
 /* get current cursor x position */
 int
 nf_getx(void)
@@ -65,23 +203,65 @@ nf_putc(unsigned char c)
     nf_intr(0x10, &regs);
 }
 
+/*
+ * print a buffer of n characters to the screen. line feeds are expanded
+ * into a local buffer, which is written at the cursor with a single
+ * INT 10h AH=13h call per chunk, instead of one AH=0Eh call per character
+ */
+void
+nf_write(const char *s, size_t n)
+{
+    char buf[128];
+    struct nf_regs regs;
+    int len;
+
+    while (n) {
+        /* leave room for a CR LF pair */
+        for (len = 0; n && len < (int)sizeof(buf) - 1; --n, ++s) {
+            if (*s == '\n')
+                buf[len++] = '\r';
+            buf[len++] = *s;
+        }
+
+        /* get the cursor position into dx */
+        regs.ax = 0x0300;
+        regs.bx = 0x0000;
+        nf_intr(0x10, &regs);
+
+        /* write es:bp in teletype mode, moving the cursor */
+        regs.ax = 0x1301;
+        regs.bx = 0x0007;
+        regs.cx = len;
+        regs.bp = (int)buf;
+        nf_intr(0x10, &regs);
+    }
+}
+
 /* print a string to the screen */
 static void
 nf_puts(char *s)
 {
-    while (*s) {
-        if (*s == '\n')
-            nf_putc('\r');
-        nf_putc(*s);
-        s++;
-    }
+    nf_write(s, nf_strlen(s));
 }
 
-/* read a single character */
+/* read a single character, letting other tasks run until a key is pressed */
 char
 nf_getc(void)
 {
     struct nf_regs regs;
+
+    for (;;) {
+        regs.ax = 0x0100;
+        nf_intr(0x16, &regs);
+
+        /* ZF is clear if a key is available */
+        if (!(regs.flags & 0x40)) {
+            break;
+        }
+
+        nf_task_yield();
+    }
+
     regs.ax = 0x0000;
     nf_intr(0x16, &regs);
     return regs.ax & 0xff;
@@ -111,6 +291,12 @@ nf_readline(void)
             nf_printf("\n");
             *buf = 0;
             return start;
+        } else if (!ch && nf_irq_break) {
+            /* Ctrl-Break at the prompt discards the line */
+            nf_irq_break = 0;
+            nf_printf("\n");
+            *start = 0;
+            return start;
         } else if (buf < end) {
             nf_putc(ch);
             *buf = ch;
@@ -139,12 +325,87 @@ nf_printf(const char *format, ...)
     return ret;
 }
 
+/* split DOS command tail into arguments, return their amount */
+int
+nf_get_args(char ***argv)
+{
+    char *p = (char *)0x81;
+    char *end;
+    int argc = 0;
+
+    nf_args[argc++] = "NF";
+
+    if (nf_is_dos()) {
+        end = p + *((unsigned char *)0x80);
+        *end = 0;
+
+        while (p < end && argc < NF_MAX_ARGS) {
+            if (*p == ' ' || *p == '\t') {
+                *p++ = 0;
+                continue;
+            }
+
+            nf_args[argc++] = p;
+
+            while (*p && *p != ' ' && *p != '\t') {
+                ++p;
+            }
+        }
+    }
+
+    nf_args[argc] = 0;
+    *argv = nf_args;
+
+    return argc;
+}
+
+/* write a buffer to a new file. return 0 on success or -1 on error */
+int
+nf_save_file(const char *name, const void *buf, size_t len)
+{
+    struct nf_regs regs;
+    int fd, err;
+
+    if (!nf_is_dos()) {
+        return -1;
+    }
+
+    /* create or truncate */
+    regs.ax = 0x3c00;
+    regs.cx = 0;
+    regs.dx = (int)name;
+    nf_intr(0x21, &regs);
+
+    if (regs.flags & 1) {
+        return -1;
+    }
+
+    fd = regs.ax;
+
+    /* write */
+    regs.ax = 0x4000;
+    regs.bx = fd;
+    regs.cx = (int)len;
+    regs.dx = (int)buf;
+    nf_intr(0x21, &regs);
+
+    err = (regs.flags & 1) || (size_t)regs.ax != len;
+
+    /* close */
+    regs.ax = 0x3e00;
+    regs.bx = fd;
+    nf_intr(0x21, &regs);
+
+    return (err || (regs.flags & 1)) ? -1 : 0;
+}
+
 /* exit interpreter with given status code */
 void
 nf_exit(char code)
 {
-    if (*((unsigned *)0) == 0x20CD) {
+    if (nf_is_dos()) {
         struct nf_regs regs;
+        nf_irq_done();
         regs.ax = 0x4c00 | code;
         nf_intr(0x21, &regs);
     }
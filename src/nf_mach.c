@@ -30,6 +30,12 @@ nf_data_check(struct nf_machine *m, size_t count_in, size_t count_out)
         return -1;
     }
 
+    /* track the high-water mark, see nf_stat.c */
+    used = used - count_in + count_out;
+    if (used > m->data_peak) {
+        m->data_peak = used;
+    }
+
     return 0;
 }
 
@@ -67,6 +73,10 @@ nf_stmt_push(struct nf_machine *m, enum nf_stmt_type type, struct nf_instr *ip)
 
     ++(m->stmt_sp);
 
+    if (nf_stmt_count(m) > m->stmt_peak) {
+        m->stmt_peak = nf_stmt_count(m);
+    }
+
     return 0;
 }
 
@@ -99,18 +109,165 @@ void
 nf_comp_start(struct nf_machine *m)
 {
     m->comp_ip = m->comp_buf;
+    m->comp_str = 0;
+    m->comp_mark = m->comp_buf;
+    m->local_count = 0;
+    m->local_decl = 0;
+    m->quot_depth = 0;
     m->stmt_sp = m->stmt_stack;
     m->state = NF_STATE_COMPILE;
 }
 
+/*
+ * replace a call of an operator, which follows literals with all of its
+ * operands, by a literal with the result. return 0 if it's not possible
+ */
+int
+nf_comp_fold(struct nf_machine *m, struct nf_word *w)
+{
+    struct nf_instr *i = m->comp_ip - w->fold;
+    nf_cell_t *data_sp = m->data_sp;
+    nf_word_handler_t handler;
+    nf_cell_t val;
+    int n;
+
+    /* branches may point past the compiled code, see comp_mark */
+    if (!w->fold || i < m->comp_mark ||
+        (size_t)(NF_DATA_STACK_SIZE - (data_sp - m->data_stack)) <
+        (size_t)w->fold) {
+        return 0;
+    }
+
+    for (n = 0; n < w->fold; ++n) {
+        if (i[n].opcode != NF_OPCODE_LITERAL) {
+            return 0;
+        }
+    }
+
+    /* evaluate it on top of the data stack */
+    for (n = 0; n < w->fold; ++n) {
+        nf_data_push(m, i[n].value);
+    }
+
+    handler = (nf_word_handler_t)w->data;
+    if (handler(m)) {
+        m->data_sp = data_sp;
+        return 0;
+    }
+
+    val = nf_data_pop(m);
+    m->data_sp = data_sp;
+
+    m->comp_ip = i;
+    m->comp_str = 0;
+    nf_comp_instr(m, NF_OPCODE_LITERAL, val);
+
+    return 1;
+}
+
+/* check if the instruction at i returns, directly or through branches */
+static int
+nf_comp_returns(struct nf_instr *i)
+{
+    int n;
+
+    /* give up on long chains and cycles */
+    for (n = 0; n < 8 && i->opcode == NF_OPCODE_BRANCH; ++n) {
+        i += i->value;
+    }
+
+    return i->opcode == NF_OPCODE_RETURN;
+}
+
+/*
+ * turn calls of compiled words followed by a return into tail calls,
+ * which reuse the frame of nf_exec, and recursion into a branch
+ */
+static void
+nf_comp_tail(struct nf_instr *start, struct nf_instr *end)
+{
+    struct nf_instr *i;
+    struct nf_word *w;
+
+    for (i = start; i < end - 1; ++i) {
+        if (!nf_comp_returns(i + 1)) {
+            continue;
+        }
+
+        if (i->opcode == NF_OPCODE_RECURSE) {
+            i->opcode = NF_OPCODE_BRANCH;
+        }
+
+        if (i->opcode == NF_OPCODE_CALL) {
+            w = (struct nf_word *)i->value;
+
+            if (w->type == NF_WORD_COMP) {
+                i->opcode = NF_OPCODE_TAILCALL;
+            }
+        }
+    }
+}
+
 /* finish compilation */
 void
 nf_comp_finish(struct nf_machine *m)
 {
-    nf_comp_instr(m, NF_OPCODE_RETURN, 0);
+    if (nf_comp_instr(m, NF_OPCODE_RETURN, 0)) {
+        nf_comp_tail(m->comp_buf, m->comp_ip);
+    }
+
+    m->local_count = 0;
     m->state = NF_STATE_INTERPRET;
 }
 
+/*
+ * finish a quotation compiled from start, move its code to the heap and
+ * remove it from the compilation buffer. branches are relative and can't
+ * leave the quotation, so the code works as is.
+ * return the code or 0 on error
+ */
+struct nf_instr *
+nf_comp_quot(struct nf_machine *m, struct nf_instr *start)
+{
+    struct nf_instr *code;
+    size_t n;
+
+    if (!nf_comp_instr(m, NF_OPCODE_RETURN, 0)) {
+        nf_error(("compilation buffer overflow"));
+        return 0;
+    }
+
+    nf_comp_tail(start, m->comp_ip);
+
+    n = m->comp_ip - start;
+    code = nf_malloc(n * sizeof(struct nf_instr));
+    if (!code) {
+        nf_error(("out of memory"));
+        return 0;
+    }
+    nf_memcpy(code, start, n * sizeof(struct nf_instr));
+
+    m->comp_ip = start;
+    m->comp_str = 0;
+
+    return code;
+}
+
+/* return the index of a local of the word being compiled, or -1 */
+int
+nf_comp_local(struct nf_machine *m, char *name)
+{
+    int i;
+
+    for (i = m->local_count - 1; i >= 0; --i) {
+        if (!nf_strcmp(m->local_names[i], name)) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
 /*
  * append instruction to the compilation buffer
  * return pointer to the instruction or 0 on overflow
@@ -125,22 +282,71 @@ nf_comp_instr(struct nf_machine *m, nf_cell_t opcode, nf_cell_t value)
     m->comp_ip->opcode = opcode;
     m->comp_ip->value = value;
 
+    if ((size_t)(m->comp_ip - m->comp_buf) >= m->comp_peak) {
+        m->comp_peak = m->comp_ip - m->comp_buf + 1;
+    }
+
     return (m->comp_ip)++;
 }
 
+/* handle timer ticks and breaks on calls and branches, see nf_irq.c */
+#define NF_CHECK_IRQ(m)                                     \
+    if (NF_IRQ_LOAD(nf_irq_pending) && nf_irq_handle(m)) {  \
+        ret = -1;                                           \
+        break;                                              \
+    }
+
+#ifndef NF_NO_TRACE
+/* record a call made by compiled code, see nf_trce.c */
+#define NF_TRACE_CALL(m, w)                                         \
+    t = &(m)->trace[(m)->trace_pos++ & (NF_TRACE_SIZE - 1)];        \
+    t->word = (w);                                                  \
+    t->index = (int)(i - start);                                    \
+    t->tos = ((m)->data_sp > (m)->data_stack) ? (m)->data_sp[-1] : 0
+#else
+#define NF_TRACE_CALL(m, w)
+#endif
+
 /* execute nf bytecode */
 int
 nf_exec(struct nf_machine *m, struct nf_instr *i)
 {
-    nf_cell_t v;
+    nf_cell_t v, d;
+    struct nf_loop *l;
+    struct nf_loop *loop_sp = m->loop_sp;
+    nf_cell_t *frame = m->local_sp;
     enum nf_machine_state state = m->state;
     int ret = 0;
 
+#ifndef NF_NO_TRACE
+    struct nf_instr *start = i;
+    struct nf_trace *t;
+#endif
+
+#ifdef NF_OPSTAT
+    int prev = -1;
+#endif
+
+    /* the watchdog budget is counted from the outermost call */
+    if (!m->exec_depth && m->watchdog) {
+        m->watch_start = nf_clock();
+    }
+
     m->state = NF_STATE_EXECUTE;
+    m->exec_depth++;
 
     while (1) {
+#ifdef NF_OPSTAT
+        nf_opstat_count(m, prev, i);
+        prev = i->opcode;
+#endif
+
         if (i->opcode == NF_OPCODE_CALL) {
             struct nf_word *w = (struct nf_word *)i->value;
+
+            NF_CHECK_IRQ(m);
+            NF_TRACE_CALL(m, w);
+
             if (nf_call_word(m, w)) {
                 ret = -1;
                 break;
@@ -157,7 +363,44 @@ nf_exec(struct nf_machine *m, struct nf_instr *i)
             i++;
         }
 
+        else if (i->opcode == NF_OPCODE_FETCH) {
+            if (nf_data_check(m, 0, 1)) {
+                ret = -1;
+                break;
+            }
+            nf_data_push(m, *(nf_cell_t *)i->value);
+            i++;
+        }
+
+        else if (i->opcode == NF_OPCODE_STORE) {
+            if (nf_data_check(m, 1, 0)) {
+                ret = -1;
+                break;
+            }
+            *(nf_cell_t *)i->value = nf_data_pop(m);
+            i++;
+        }
+
+        else if (i->opcode == NF_OPCODE_LOCAL_FETCH) {
+            if (nf_data_check(m, 0, 1)) {
+                ret = -1;
+                break;
+            }
+            nf_data_push(m, frame[i->value]);
+            i++;
+        }
+
+        else if (i->opcode == NF_OPCODE_LOCAL_STORE) {
+            if (nf_data_check(m, 1, 0)) {
+                ret = -1;
+                break;
+            }
+            frame[i->value] = nf_data_pop(m);
+            i++;
+        }
+
         else if (i->opcode == NF_OPCODE_BRANCH) {
+            NF_CHECK_IRQ(m);
             i += i->value;
         }
 
@@ -166,6 +409,7 @@ nf_exec(struct nf_machine *m, struct nf_instr *i)
                 ret = -1;
                 break;
             }
+            NF_CHECK_IRQ(m);
             v = nf_data_pop(m);
             i += (v ? i->value : 1);
         }
@@ -175,6 +419,7 @@ nf_exec(struct nf_machine *m, struct nf_instr *i)
                 ret = -1;
                 break;
             }
+            NF_CHECK_IRQ(m);
             v = nf_data_pop(m);
             i += (!v ? i->value : 1);
         }
@@ -184,6 +429,123 @@ nf_exec(struct nf_machine *m, struct nf_instr *i)
             break;
         }
 
+        else if (i->opcode == NF_OPCODE_LOOP) {
+            NF_CHECK_IRQ(m);
+            l = m->loop_sp - 1;
+            if (++l->index < l->limit) {
+                i += i->value;
+            } else {
+                m->loop_sp = l;
+                i++;
+            }
+        }
+
+        else if (i->opcode == NF_OPCODE_LOOP_INDEX) {
+            if (m->loop_sp - m->loop_stack <= i->value) {
+                nf_error(("not in a loop"));
+                ret = -1;
+                break;
+            }
+            if (nf_data_check(m, 0, 1)) {
+                ret = -1;
+                break;
+            }
+            nf_data_push(m, m->loop_sp[-1 - i->value].index);
+            i++;
+        }
+
+        else if (i->opcode == NF_OPCODE_PLUS_LOOP) {
+            if (nf_data_check(m, 1, 0)) {
+                ret = -1;
+                break;
+            }
+            NF_CHECK_IRQ(m);
+            v = nf_data_pop(m);
+            l = m->loop_sp - 1;
+
+            /* finish when crossing the boundary between limit-1 and limit */
+            d = l->index - l->limit;
+            l->index += v;
+            if ((d ^ (d + v)) >= 0) {
+                i += i->value;
+            } else {
+                m->loop_sp = l;
+                i++;
+            }
+        }
+
+        else if (i->opcode == NF_OPCODE_DO) {
+            if (nf_data_check(m, 2, 0)) {
+                ret = -1;
+                break;
+            }
+            if (m->loop_sp - m->loop_stack >= NF_LOOP_STACK_SIZE) {
+                nf_error(("loop stack overflow"));
+                ret = -1;
+                break;
+            }
+            l = m->loop_sp++;
+            l->index = nf_data_pop(m);
+            l->limit = nf_data_pop(m);
+            i++;
+        }
+
+        else if (i->opcode == NF_OPCODE_TAILCALL) {
+            struct nf_word *w = (struct nf_word *)i->value;
+
+            NF_CHECK_IRQ(m);
+            NF_TRACE_CALL(m, w);
+
+            /* the profiler needs a call of its own */
+            if (m->profile) {
+                ret = nf_call_word(m, w);
+                break;
+            }
+
+            /* continue in the word, in place of returning from this one */
+            i = w->data;
+#ifndef NF_NO_TRACE
+            start = i;
+#endif
+        }
+
+        else if (i->opcode == NF_OPCODE_RECURSE) {
+            NF_CHECK_IRQ(m);
+            if (nf_exec(m, i + i->value)) {
+                ret = -1;
+                break;
+            }
+            i++;
+        }
+
+        else if (i->opcode == NF_OPCODE_LOCALS) {
+            if (nf_data_check(m, i->value, 0)) {
+                ret = -1;
+                break;
+            }
+            if (frame - m->local_stack > NF_LOCALS_SIZE - i->value) {
+                nf_error(("locals stack overflow"));
+                ret = -1;
+                break;
+            }
+            /*
+             * the frame always starts where it did on entry, so that tail
+             * calls reuse it. the first local is the deepest argument
+             */
+            m->local_sp = frame + i->value;
+            for (v = 1; v <= i->value; ++v) {
+                m->local_sp[-v] = nf_data_pop(m);
+            }
+            i++;
+        }
+
+        else if (i->opcode == NF_OPCODE_LEAVE) {
+            /* jump to 'do', which points past the loop */
+            m->loop_sp--;
+            i += i->value;
+            i += i->value;
+        }
+
         else {
             nf_error(("invalid opcode: %d/%ld", i->opcode, i->value));
             ret = -1;
@@ -192,13 +554,55 @@ nf_exec(struct nf_machine *m, struct nf_instr *i)
     }
 
     m->state = state;
+    m->exec_depth--;
+
+    /* drop the frame of locals */
+    m->local_sp = frame;
+
+    /* drop loops interrupted by an error */
+    if (ret) {
+        m->loop_sp = loop_sp;
+    }
+
+#ifndef NF_NO_TRACE
+    /* show how the outermost code got to the error */
+    if (ret && !m->exec_depth) {
+        nf_trace_dump(m);
+    }
+#endif
 
     return ret;
 }
 
-/* create new nf_machine on the heap. return 0 if there's not enough memory */
-struct nf_machine *
-nf_init_machine(int argc, char **argv)
+/*
+ * reset the stacks, the compiler and the interpreter, as left by a word
+ * which was aborted in the middle of execution or compilation
+ */
+void
+nf_reset_machine(struct nf_machine *m)
+{
+    m->data_sp = m->data_stack;
+    m->stmt_sp = m->stmt_stack;
+    m->loop_sp = m->loop_stack;
+    m->local_sp = m->local_stack;
+    m->comp_ip = m->comp_buf;
+    m->comp_str = 0;
+    m->comp_mark = m->comp_buf;
+    m->local_count = 0;
+    m->local_decl = 0;
+    m->quot_depth = 0;
+    m->line_p = m->line_buf;
+    m->src_next = 0;
+    m->src_line = 0;
+    m->block_src = 0;
+
+    m->state = NF_STATE_INTERPRET;
+    m->exec_depth = 0;
+}
+
+/* allocate a machine with no words. return 0 if there's not enough memory */
+static struct nf_machine *
+nf_alloc_machine(int argc, char **argv)
 {
     struct nf_machine *m;
 
@@ -206,17 +610,95 @@ nf_init_machine(int argc, char **argv)
     if (!m)
         return 0;
 
-    m->data_sp = m->data_stack;
-    m->line_p = m->line_buf;
+    nf_reset_machine(m);
+
+    nf_block_reset(m);
+    m->block_hits = 0;
+    m->block_misses = 0;
 
-    m->state = NF_STATE_INTERPRET;
     m->words = 0;
+    m->shared_words = 0;
+    m->bufs = 0;
 
     m->argc = argc;
     m->argv = argv;
 
+    m->watchdog = 0;
+
+#ifndef NF_NO_TRACE
+    m->trace_pos = 0;
+#endif
+
+    m->data_peak = 0;
+    m->stmt_peak = 0;
+    m->comp_peak = 0;
+
+    m->profile = 0;
+    m->prof_child = 0;
+    m->prof_counts = 0;
+    m->prof_size = 0;
+
+#ifdef NF_OPSTAT
+    nf_opstat_reset(m);
+#endif
+
+    return m;
+}
+
+/* create new nf_machine on the heap. return 0 if there's not enough memory */
+struct nf_machine *
+nf_init_machine(int argc, char **argv)
+{
+    struct nf_machine *m;
+
+    m = nf_alloc_machine(argc, argv);
+    if (!m)
+        return 0;
+
     nf_define_base_words(m);
     nf_define_stmt_words(m);
+    nf_define_prof_words(m);
+    nf_define_stat_words(m);
+    nf_define_task_words(m);
+    nf_define_irq_words(m);
+    nf_define_mem_words(m);
+    nf_define_inline_words(m);
+    nf_define_str_words(m);
+    nf_define_block_words(m);
+
+#ifndef NF_NO_TRACE
+    nf_define_trace_words(m);
+#endif
+
+#ifdef NF_OPSTAT
+    nf_define_opstat_words(m);
+#endif
+
+    nf_stat_reset(m);
+
+    return m;
+}
+
+/*
+ * create new nf_machine on the heap, sharing the dictionary of base
+ * instead of defining its own. the shared words are read-only for the new
+ * machine: its definitions shadow them, and assigning a shared variable
+ * defines a copy, see nf_word_is_shared. base must not assign its shared
+ * variables either, while the new machine is in use.
+ * return 0 if there's not enough memory
+ */
+struct nf_machine *
+nf_fork_machine(struct nf_machine *base)
+{
+    struct nf_machine *m;
+
+    m = nf_alloc_machine(base->argc, base->argv);
+    if (!m)
+        return 0;
+
+    m->words = base->words;
+    m->shared_words = base->words;
+    m->bufs = base->bufs;
 
     return m;
 }
@@ -11,101 +11,131 @@
 
 /* platform functions */
 char *nf_readline(void);
+int nf_get_args(char ***);
+int nf_save_file(const char *, const void *, size_t);
+void nf_clock_init(void);
 void nf_define_x86_words(struct nf_machine *);
 
-/* embedded init code (from nf_strt.asm) */
+/* embedded init code and its snapshot (from nf_strt.asm) */
 extern void *nf_init_code;
 extern void *nf_init_code_end;
+extern void *nf_snap_image;
+extern void *nf_snap_image_end;
+
+/* prompt rendering */
+#define NF_PROMPT_WIDTH     79
+#define NF_PROMPT_BUF_SIZE  160
 
 /* local functions */
+static char *nf_prompt_cat(char *p, const char *s);
 static void nf_print_prompt(struct nf_machine *m);
-static void nf_interpret_init(struct nf_machine *);
+static void nf_save_snapshot(struct nf_machine *, const char *);
+
+/* append a string to the prompt buffer, return pointer to its end */
+static char *
+nf_prompt_cat(char *p, const char *s)
+{
+    while (*s) {
+        *p++ = *s++;
+    }
+
+    return p;
+}
 
-/* print fancy prompt */
+/* print fancy prompt, rendered into a single buffer */
 static void
 nf_print_prompt(struct nf_machine *m)
 {
+    char buf[NF_PROMPT_BUF_SIZE];
+    char *p = buf;
+    char *line;
     size_t n;
     nf_cell_t *c;
 
     if (nf_getx() != 0) {
-        nf_printf("\n");
+        *p++ = '\n';
     }
 
     if (m->state != NF_STATE_INTERPRET) {
-        nf_printf(" ... ");
+        p = nf_prompt_cat(p, " ... ");
+        nf_write(buf, p - buf);
         return;
     }
 
-    nf_printf("\xda\xc4\xc4[");
+    /* the rule is as wide as the characters emitted since line start */
+    line = p;
+
+    p = nf_prompt_cat(p, "\xda\xc4\xc4[");
 
     n = m->data_sp - m->data_stack;
 
     if (n > 5) {
-        nf_printf("... ");
+        p = nf_prompt_cat(p, "... ");
     }
 
     c = (n > 5) ? m->data_sp - 5 : m->data_stack;
 
     while (c < m->data_sp) {
-        nf_printf("%ld", *c);
+        p += nf_itoa(*c, p);
 
         if (c < m->data_sp - 1) {
-            nf_printf(" ");
+            *p++ = ' ';
         }
 
         ++c;
     }
 
-    nf_printf("]");
+    *p++ = ']';
 
-    while (nf_getx() < 79) {
-        nf_printf("\xc4");
+    while (p - line < NF_PROMPT_WIDTH) {
+        *p++ = '\xc4';
     }
 
-    nf_printf("\n\xc0>>> ");
+    p = nf_prompt_cat(p, "\n\xc0>>> ");
+
+    nf_write(buf, p - buf);
 }
 
-/* interpret embedded init code line by line */
+/* create snapshot of the init code, save it to a file and exit */
 static void
-nf_interpret_init(struct nf_machine *m)
+nf_save_snapshot(struct nf_machine *m, const char *name)
 {
-    const char *p = (const char *)&nf_init_code;
+    const char *code = (const char *)&nf_init_code;
     const char *end = (const char *)&nf_init_code_end;
-    char buf[NF_LINE_BUF_SIZE];
-    int i;
-
-    while (p < end) {
-        /* copy one line into buf */
-        i = 0;
-        while (p < end && *p != '\n' && *p != '\r' && i < NF_LINE_BUF_SIZE - 1) {
-            buf[i++] = *p++;
-        }
-        buf[i] = '\0';
+    char *snap;
+    size_t len;
 
-        /* skip line endings */
-        while (p < end && (*p == '\r' || *p == '\n')) {
-            ++p;
-        }
+    snap = nf_snap_create(m, code, end, &len);
 
-        /* interpret the line */
-        if (i > 0) {
-            nf_intp_line(m, buf);
-        }
+    if (!snap) {
+        nf_exit(1);
+    }
+
+    if (nf_save_file(name, snap, len)) {
+        nf_error(("cannot write %s", name));
+        nf_exit(1);
     }
+
+    nf_printf("%s: %u bytes\n", name, (unsigned)len);
+    nf_exit(0);
 }
 
 /* main entry point */
 void
 main(void)
 {
-    static char *argv[1] = { 0 };
     struct nf_machine *m;
+    char **argv;
     char *line;
+    int argc;
 
     nf_printf("\n");
 
-    m = nf_init_machine(0, argv);
+    nf_clock_init();
+    nf_irq_init();
+
+    argc = nf_get_args(&argv);
+    m = nf_init_machine(argc, argv);
 
     if (!m) {
         nf_error(("error: out of memory\n"));
@@ -115,8 +145,17 @@ main(void)
     /* setup x86-specific words */
     nf_define_x86_words(m);
 
-    /* interpret embedded init code */
-    nf_interpret_init(m);
+    /* build-time mode, see the NF_SNAP.BIN rule in Makefile */
+    if (argc == 3 && !nf_strcmp(argv[1], "/S")) {
+        nf_save_snapshot(m, argv[2]);
+    }
+
+    /* map in the prebuilt snapshot, or interpret embedded init code */
+    if (nf_snap_load(m, (const char *)&nf_snap_image,
+                     (const char *)&nf_snap_image_end)) {
+        (void)nf_intp_text(m, (const char *)&nf_init_code,
+                           (const char *)&nf_init_code_end);
+    }
 
     /* interactive interpreter loop */
     for (;;) {
@@ -0,0 +1,446 @@
+/*
+ * Copyright (c) 2026 luke8086.
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * nf_mem.c - memory access words
+ *
+ * Buffers are allocated on the heap with 'allot' or 'create', and linked
+ * to the machine, so that the bulk words can check that the memory they
+ * operate on belongs to a single buffer. The fetch and store words are
+ * not checked, to keep them as cheap as a stack operation.
+ *
+ * The bulk words transfer whole cells (machine words) where both areas
+ * are equally aligned, and bytes only at the edges.
+ */
+
+#include "nf_cmmn.h"
+
+/* buffer header, followed by the data */
+struct nf_buf {
+    struct nf_buf *next;
+    size_t size;
+};
+
+#define NF_MEM_WORD         sizeof(uintmax_t)
+#define NF_MEM_ALIGN(p)     ((size_t)(p) & (NF_MEM_WORD - 1))
+
+/* largest count of cells with a size in bytes fitting in a cell */
+#define NF_MEM_CELLS_MAX    ((nf_cell_t)((uintmax_t)-1 >> 1) / \
+                             (nf_cell_t)sizeof(nf_cell_t))
+
+/* local functions */
+static void nf_mem_fill(unsigned char *p, size_t n, unsigned char c);
+static void nf_mem_move(unsigned char *dst, const unsigned char *src,
+                        size_t n);
+static int nf_mem_compare(const unsigned char *a, const unsigned char *b,
+                          size_t n);
+
+/* set n bytes at p to c */
+static void
+nf_mem_fill(unsigned char *p, size_t n, unsigned char c)
+{
+    uintmax_t w = 0;
+    size_t i;
+
+    for (i = 0; i < NF_MEM_WORD; ++i) {
+        w = (w << 8) | c;
+    }
+
+    while (n && NF_MEM_ALIGN(p)) {
+        *p++ = c;
+        --n;
+    }
+
+    for (; n >= NF_MEM_WORD; n -= NF_MEM_WORD, p += NF_MEM_WORD) {
+        *(uintmax_t *)p = w;
+    }
+
+    while (n--) {
+        *p++ = c;
+    }
+}
+
+/* copy n bytes from src to dst, which may overlap */
+static void
+nf_mem_move(unsigned char *dst, const unsigned char *src, size_t n)
+{
+    int words = (NF_MEM_ALIGN(dst) == NF_MEM_ALIGN(src));
+
+    if (dst <= src || dst >= src + n) {
+        if (words) {
+            while (n && NF_MEM_ALIGN(dst)) {
+                *dst++ = *src++;
+                --n;
+            }
+
+            for (; n >= NF_MEM_WORD; n -= NF_MEM_WORD) {
+                *(uintmax_t *)dst = *(const uintmax_t *)src;
+                dst += NF_MEM_WORD;
+                src += NF_MEM_WORD;
+            }
+        }
+
+        while (n--) {
+            *dst++ = *src++;
+        }
+
+        return;
+    }
+
+    /* dst overlaps the end of src, copy backwards */
+    dst += n;
+    src += n;
+
+    if (words) {
+        while (n && NF_MEM_ALIGN(dst)) {
+            *--dst = *--src;
+            --n;
+        }
+
+        for (; n >= NF_MEM_WORD; n -= NF_MEM_WORD) {
+            dst -= NF_MEM_WORD;
+            src -= NF_MEM_WORD;
+            *(uintmax_t *)dst = *(const uintmax_t *)src;
+        }
+    }
+
+    while (n--) {
+        *--dst = *--src;
+    }
+}
+
+/* compare n bytes, return -1, 0 or 1 */
+static int
+nf_mem_compare(const unsigned char *a, const unsigned char *b, size_t n)
+{
+    if (NF_MEM_ALIGN(a) == NF_MEM_ALIGN(b)) {
+        while (n && NF_MEM_ALIGN(a) && *a == *b) {
+            ++a;
+            ++b;
+            --n;
+        }
+
+        /* skip equal words, a difference is then found byte by byte */
+        if (!NF_MEM_ALIGN(a)) {
+            while (n >= NF_MEM_WORD &&
+                   *(const uintmax_t *)a == *(const uintmax_t *)b) {
+                a += NF_MEM_WORD;
+                b += NF_MEM_WORD;
+                n -= NF_MEM_WORD;
+            }
+        }
+    }
+
+    for (; n; --n, ++a, ++b) {
+        if (*a != *b) {
+            return (*a < *b) ? -1 : 1;
+        }
+    }
+
+    return 0;
+}
+
+/* check if n bytes at addr are inside a single buffer. on failure, display an error and return -1 */
+int
+nf_mem_check(struct nf_machine *m, nf_cell_t addr, nf_cell_t n)
+{
+    unsigned char *p = (unsigned char *)addr;
+    unsigned char *start;
+    struct nf_buf *b;
+
+    if (n < 0) {
+        nf_error(("invalid size"));
+        return -1;
+    }
+
+    for (b = m->bufs; b; b = b->next) {
+        start = (unsigned char *)(b + 1);
+
+        if (p >= start && (size_t)n <= b->size &&
+            (size_t)(p - start) <= b->size - (size_t)n) {
+            return 0;
+        }
+    }
+
+    nf_error(("out of bounds"));
+    return -1;
+}
+
+/* allocate a zeroed buffer of n bytes. on failure, display an error and return 0 */
+unsigned char *
+nf_mem_allot(struct nf_machine *m, nf_cell_t n)
+{
+    struct nf_buf *b;
+
+    if (n < 0) {
+        nf_error(("invalid size"));
+        return 0;
+    }
+
+    b = nf_malloc(sizeof(struct nf_buf) + (size_t)n);
+    if (!b) {
+        nf_error(("out of memory"));
+        return 0;
+    }
+
+    b->size = (size_t)n;
+    b->next = m->bufs;
+    m->bufs = b;
+
+    nf_mem_fill((unsigned char *)(b + 1), b->size, 0);
+
+    return (unsigned char *)(b + 1);
+}
+
+/* '@' ( a -- n ) */
+static int
+nf_mem_fetch(struct nf_machine *m)
+{
+    nf_cell_t a;
+
+    if (nf_data_check(m, 1, 1))
+        return -1;
+
+    a = nf_data_pop(m);
+    nf_data_push(m, *(nf_cell_t *)a);
+
+    return 0;
+}
+
+/* '@=' ( n a -- ) */
+static int
+nf_mem_store(struct nf_machine *m)
+{
+    nf_cell_t a, n;
+
+    if (nf_data_check(m, 2, 0))
+        return -1;
+
+    a = nf_data_pop(m);
+    n = nf_data_pop(m);
+    *(nf_cell_t *)a = n;
+
+    return 0;
+}
+
+/* 'c@' ( a -- c ) */
+static int
+nf_mem_c_fetch(struct nf_machine *m)
+{
+    nf_cell_t a;
+
+    if (nf_data_check(m, 1, 1))
+        return -1;
+
+    a = nf_data_pop(m);
+    nf_data_push(m, *(unsigned char *)a);
+
+    return 0;
+}
+
+/* 'c@=' ( c a -- ) */
+static int
+nf_mem_c_store(struct nf_machine *m)
+{
+    nf_cell_t a, c;
+
+    if (nf_data_check(m, 2, 0))
+        return -1;
+
+    a = nf_data_pop(m);
+    c = nf_data_pop(m);
+    *(unsigned char *)a = (unsigned char)c;
+
+    return 0;
+}
+
+/* 'cells' ( n -- n ) */
+static int
+nf_mem_cells(struct nf_machine *m)
+{
+    nf_cell_t n;
+
+    if (nf_data_check(m, 1, 1))
+        return -1;
+
+    n = nf_data_pop(m);
+    nf_data_push(m, n * (nf_cell_t)sizeof(nf_cell_t));
+
+    return 0;
+}
+
+/* 'allot' ( n -- a ) */
+static int
+nf_mem_allot_word(struct nf_machine *m)
+{
+    unsigned char *p;
+
+    if (nf_data_check(m, 1, 1))
+        return -1;
+
+    p = nf_mem_allot(m, nf_data_pop(m));
+    if (!p) {
+        return -1;
+    }
+
+    nf_data_push(m, (nf_cell_t)p);
+
+    return 0;
+}
+
+/* 'create' ( n s -- ) define a constant with the address of a new buffer */
+static int
+nf_mem_create(struct nf_machine *m)
+{
+    unsigned char *p;
+    struct nf_word *w;
+    char *name;
+
+    if (nf_data_check(m, 2, 0))
+        return -1;
+
+    name = (char *)nf_data_pop(m);
+
+    p = nf_mem_allot(m, nf_data_pop(m));
+    if (!p) {
+        return -1;
+    }
+
+    /* a constant, so that ':=' can't point it elsewhere */
+    w = nf_init_var(m, name, (nf_cell_t)p);
+    if (!w) {
+        nf_error(("out of memory"));
+        return -1;
+    }
+    w->type = NF_WORD_CONST;
+    nf_define_word(m, w);
+
+    return 0;
+}
+
+/* 'fill' ( a n c -- ) */
+static int
+nf_mem_fill_word(struct nf_machine *m)
+{
+    nf_cell_t a, n, c;
+
+    if (nf_data_check(m, 3, 0))
+        return -1;
+
+    c = nf_data_pop(m);
+    n = nf_data_pop(m);
+    a = nf_data_pop(m);
+
+    if (nf_mem_check(m, a, n))
+        return -1;
+
+    nf_mem_fill((unsigned char *)a, (size_t)n, (unsigned char)c);
+
+    return 0;
+}
+
+/* 'move' ( a1 a2 n -- ) copy n bytes from a1 to a2 */
+static int
+nf_mem_move_word(struct nf_machine *m)
+{
+    nf_cell_t a1, a2, n;
+
+    if (nf_data_check(m, 3, 0))
+        return -1;
+
+    n = nf_data_pop(m);
+    a2 = nf_data_pop(m);
+    a1 = nf_data_pop(m);
+
+    if (nf_mem_check(m, a1, n) || nf_mem_check(m, a2, n))
+        return -1;
+
+    nf_mem_move((unsigned char *)a2, (const unsigned char *)a1, (size_t)n);
+
+    return 0;
+}
+
+/* 'compare' ( a1 a2 n -- r ) r is -1, 0 or 1 */
+static int
+nf_mem_compare_word(struct nf_machine *m)
+{
+    nf_cell_t a1, a2, n;
+
+    if (nf_data_check(m, 3, 1))
+        return -1;
+
+    n = nf_data_pop(m);
+    a2 = nf_data_pop(m);
+    a1 = nf_data_pop(m);
+
+    if (nf_mem_check(m, a1, n) || nf_mem_check(m, a2, n))
+        return -1;
+
+    nf_data_push(m, nf_mem_compare((const unsigned char *)a1,
+                                   (const unsigned char *)a2, (size_t)n));
+
+    return 0;
+}
+
+/* 'sum' ( a n -- s ) add up n cells */
+static int
+nf_mem_sum(struct nf_machine *m)
+{
+    nf_cell_t a, n;
+    const nf_cell_t *p;
+    uintmax_t s = 0;
+
+    if (nf_data_check(m, 2, 1))
+        return -1;
+
+    n = nf_data_pop(m);
+    a = nf_data_pop(m);
+
+    if (n < 0 || n > NF_MEM_CELLS_MAX) {
+        nf_error(("invalid size"));
+        return -1;
+    }
+
+    if (nf_mem_check(m, a, n * (nf_cell_t)sizeof(nf_cell_t)))
+        return -1;
+
+    /* wrap around on overflow, instead of leaving it undefined */
+    for (p = (const nf_cell_t *)a; n; --n) {
+        s += (uintmax_t)*p++;
+    }
+
+    nf_data_push(m, (nf_cell_t)s);
+
+    return 0;
+}
+
+#define NF_DECL_PRIM(name, data) { name, NF_WORD_PRIM, data, 0 }
+
+/* append memory words to the dictionary */
+void
+nf_define_mem_words(struct nf_machine *m)
+{
+    static struct nf_word words[] = {
+        NF_DECL_PRIM("@",       (void*)nf_mem_fetch),
+        NF_DECL_PRIM("@=",      (void*)nf_mem_store),
+        NF_DECL_PRIM("c@",      (void*)nf_mem_c_fetch),
+        NF_DECL_PRIM("c@=",     (void*)nf_mem_c_store),
+        NF_DECL_PRIM("cells",   (void*)nf_mem_cells),
+        NF_DECL_PRIM("allot",   (void*)nf_mem_allot_word),
+        NF_DECL_PRIM("create",  (void*)nf_mem_create),
+        NF_DECL_PRIM("fill",    (void*)nf_mem_fill_word),
+        NF_DECL_PRIM("move",    (void*)nf_mem_move_word),
+        NF_DECL_PRIM("compare", (void*)nf_mem_compare_word),
+        NF_DECL_PRIM("sum",     (void*)nf_mem_sum),
+    };
+
+    int i, count;
+
+    count = sizeof(words) / sizeof(words[0]);
+
+    for (i = 0; i < count; ++i) {
+        nf_define_word(m, &words[i]);
+    }
+}
@@ -0,0 +1,394 @@
+/*
+ * Copyright (c) 2026 luke8086
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * src/nf_mkimg.c - build a bootable disk image from the boot sector and NF.COM
+ *
+ * The image consists of two copies of the boot sector followed by the
+ * compressed payload padded to a whole sector. Packed length in sectors,
+ * unpacked length in bytes and the checksum of the unpacked payload are
+ * stored in the image header of the boot sector, at the offset defined by
+ * IMAGE_HEADER in nf_boot.asm. The boot sector sums the payload by words,
+ * so it's padded with a zero byte to an even length.
+ *
+ * The compressed stream is a sequence of tokens decoded by nf_boot.asm:
+ *
+ *   0x00-0x7f  copy (token + 1) literal bytes following the token
+ *   0x80-0xff  copy ((token & 0x7f) + MIN_MATCH) bytes from the output,
+ *              starting (little-endian word following the token) bytes back
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SECTOR_SIZE 512
+
+/* image header layout, keep in sync with nf_boot.asm */
+#define HDR_OFFSET  0x1b0
+#define HDR_SECTORS (HDR_OFFSET + 2)
+#define HDR_LENGTH  (HDR_OFFSET + 4)
+#define HDR_SUM     (HDR_OFFSET + 6)
+
+/*
+ * the payload is loaded at 1000:0100. its end offset must not wrap, and
+ * it leaves room for the stack at the top of the segment once started
+ */
+#define MAX_PAYLOAD 0xfe00U
+
+/* compression parameters, keep MIN_MATCH in sync with nf_boot.asm */
+#define MIN_MATCH    4
+#define MAX_MATCH    (0x7f + MIN_MATCH)
+#define MAX_LITERALS 0x80
+#define WINDOW_SIZE  4096
+#define HASH_SIZE    4096
+#define MAX_CHAIN    64
+#define NO_POS       0xffffU
+
+/* packing stops as soon as the output exceeds MAX_PAYLOAD, which can */
+/* overshoot by one literal run and one match */
+#define PACK_SLACK   (MAX_LITERALS + 1 + 3)
+
+/* compressor state */
+static unsigned *head;
+static unsigned *prev;
+
+static int
+read_boot(const char *name, unsigned char *boot)
+{
+    FILE *in;
+    size_t n;
+
+    in = fopen(name, "rb");
+
+    if (!in) {
+        fprintf(stderr, "cannot open '%s'\n", name);
+        return -1;
+    }
+
+    n = fread(boot, 1, SECTOR_SIZE, in);
+
+    if (n != SECTOR_SIZE || fgetc(in) != EOF) {
+        fprintf(stderr, "'%s' is not a single sector\n", name);
+        fclose(in);
+        return -1;
+    }
+
+    fclose(in);
+
+    if (boot[510] != 0x55 || boot[511] != 0xaa ||
+        boot[HDR_OFFSET] != 'N' || boot[HDR_OFFSET + 1] != 'F') {
+        fprintf(stderr, "'%s' is not an nf boot sector\n", name);
+        return -1;
+    }
+
+    return 0;
+}
+
+/* read the whole payload into a new buffer */
+static unsigned char *
+read_payload(const char *name, unsigned *length)
+{
+    FILE *in;
+    unsigned char *buf;
+    size_t n;
+
+    /* one byte more to detect oversized files, and one for the padding */
+    buf = malloc(MAX_PAYLOAD + 2);
+
+    if (!buf) {
+        fprintf(stderr, "out of memory\n");
+        return 0;
+    }
+
+    in = fopen(name, "rb");
+
+    if (!in) {
+        fprintf(stderr, "cannot open '%s'\n", name);
+        return 0;
+    }
+
+    n = fread(buf, 1, MAX_PAYLOAD + 1, in);
+
+    if (ferror(in)) {
+        fprintf(stderr, "read error on '%s'\n", name);
+        fclose(in);
+        return 0;
+    }
+
+    fclose(in);
+
+    if (n == 0) {
+        fprintf(stderr, "'%s' is empty\n", name);
+        return 0;
+    }
+
+    if (n > MAX_PAYLOAD) {
+        fprintf(stderr, "'%s' is too large, the limit is %u bytes\n",
+                name, MAX_PAYLOAD);
+        return 0;
+    }
+
+    /* pad to an even length, see checksum */
+    if (n % 2) {
+        buf[n++] = 0;
+    }
+
+    *length = (unsigned)n;
+
+    return buf;
+}
+
+/* calculate the 16-bit sum of little-endian words, len must be even */
+static unsigned
+checksum(const unsigned char *buf, unsigned len)
+{
+    unsigned long s = 0;
+    unsigned i;
+
+    for (i = 0; i < len; i += 2) {
+        s += buf[i] | ((unsigned long)buf[i + 1] << 8);
+    }
+
+    return (unsigned)(s & 0xffff);
+}
+
+static unsigned
+hash(const unsigned char *p)
+{
+    return ((p[0] << 6) ^ (p[1] << 4) ^ (p[2] << 2) ^ p[3]) & (HASH_SIZE - 1);
+}
+
+/* add position to the hash chains */
+static void
+insert(const unsigned char *in, unsigned pos)
+{
+    unsigned h = hash(in + pos);
+
+    prev[pos & (WINDOW_SIZE - 1)] = head[h];
+    head[h] = pos;
+}
+
+/* emit literal run, return new output length */
+static unsigned
+emit_literals(unsigned char *out, unsigned o, const unsigned char *in,
+              unsigned start, unsigned end)
+{
+    unsigned n;
+
+    while (start < end && o <= MAX_PAYLOAD) {
+        n = end - start;
+        if (n > MAX_LITERALS)
+            n = MAX_LITERALS;
+
+        out[o++] = (unsigned char)(n - 1);
+        while (n--)
+            out[o++] = in[start++];
+    }
+
+    return o;
+}
+
+/*
+ * compress in into out using greedy matching, return packed length or
+ * a value above MAX_PAYLOAD if the output doesn't fit
+ */
+static unsigned
+pack(const unsigned char *in, unsigned len, unsigned char *out)
+{
+    unsigned pos = 0, lit = 0, o = 0;
+    unsigned cand, chain, max, n;
+    unsigned best_len, best_off;
+
+    for (n = 0; n < HASH_SIZE; ++n)
+        head[n] = NO_POS;
+
+    while (pos < len && o <= MAX_PAYLOAD) {
+        best_len = 0;
+        best_off = 0;
+
+        if (len - pos >= MIN_MATCH) {
+            max = len - pos < MAX_MATCH ? len - pos : MAX_MATCH;
+            cand = head[hash(in + pos)];
+
+            for (chain = MAX_CHAIN; cand != NO_POS && chain; --chain) {
+                if (pos - cand >= WINDOW_SIZE)
+                    break;
+
+                for (n = 0; n < max && in[cand + n] == in[pos + n]; ++n)
+                    ;
+
+                if (n > best_len) {
+                    best_len = n;
+                    best_off = pos - cand;
+                }
+
+                cand = prev[cand & (WINDOW_SIZE - 1)];
+            }
+        }
+
+        if (best_len < MIN_MATCH) {
+            if (len - pos >= MIN_MATCH)
+                insert(in, pos);
+            pos++;
+            continue;
+        }
+
+        o = emit_literals(out, o, in, lit, pos);
+
+        out[o++] = (unsigned char)(0x80 | (best_len - MIN_MATCH));
+        out[o++] = (unsigned char)(best_off & 0xff);
+        out[o++] = (unsigned char)(best_off >> 8);
+
+        for (n = 0; n < best_len; ++n, ++pos) {
+            if (len - pos >= MIN_MATCH)
+                insert(in, pos);
+        }
+
+        lit = pos;
+    }
+
+    return emit_literals(out, o, in, lit, pos);
+}
+
+/* decompress the way nf_boot.asm does, return unpacked length or NO_POS */
+static unsigned
+unpack(const unsigned char *in, unsigned len, unsigned char *out, unsigned max)
+{
+    unsigned i = 0, o = 0;
+    unsigned n, off;
+
+    while (i < len) {
+        n = in[i] & 0x7f;
+
+        if (in[i++] & 0x80) {
+            n += MIN_MATCH;
+            off = in[i] | (in[i + 1] << 8);
+            i += 2;
+            if (off == 0 || off > o || max - o < n)
+                return NO_POS;
+            for (; n; --n, ++o)
+                out[o] = out[o - off];
+        } else {
+            n += 1;
+            if (len - i < n || max - o < n)
+                return NO_POS;
+            for (; n; --n)
+                out[o++] = in[i++];
+        }
+    }
+
+    return o;
+}
+
+/* compare two buffers */
+static int
+same(const unsigned char *a, const unsigned char *b, unsigned len)
+{
+    while (len--) {
+        if (*a++ != *b++)
+            return 0;
+    }
+
+    return 1;
+}
+
+static int
+write_image(const char *name, const unsigned char *boot,
+            const unsigned char *packed, unsigned packed_len)
+{
+    FILE *out;
+    unsigned pad;
+    int err = 0;
+
+    out = fopen(name, "wb");
+
+    if (!out) {
+        fprintf(stderr, "cannot create '%s'\n", name);
+        return -1;
+    }
+
+    if (fwrite(boot, 1, SECTOR_SIZE, out) != SECTOR_SIZE ||
+        fwrite(boot, 1, SECTOR_SIZE, out) != SECTOR_SIZE ||
+        fwrite(packed, 1, packed_len, out) != packed_len) {
+        err = 1;
+    }
+
+    /* pad the payload to a whole sector */
+    for (pad = (SECTOR_SIZE - packed_len % SECTOR_SIZE) % SECTOR_SIZE; pad; --pad) {
+        if (fputc(0, out) == EOF)
+            err = 1;
+    }
+
+    if (fclose(out) != 0 || err) {
+        fprintf(stderr, "write error\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    static unsigned char boot[SECTOR_SIZE];
+    unsigned char *payload, *packed, *check;
+    unsigned length, packed_len, sectors, sum;
+
+    if (argc != 4) {
+        fprintf(stderr, "Usage: nf_mkimg bootsector payload outputfile\n");
+        return 1;
+    }
+
+    if (read_boot(argv[1], boot))
+        return 1;
+
+    payload = read_payload(argv[2], &length);
+    if (!payload)
+        return 1;
+
+    packed = malloc(MAX_PAYLOAD + PACK_SLACK);
+    check = malloc(length);
+    head = malloc(HASH_SIZE * sizeof(unsigned));
+    prev = malloc(WINDOW_SIZE * sizeof(unsigned));
+
+    if (!packed || !check || !head || !prev) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    packed_len = pack(payload, length, packed);
+
+    if (packed_len > MAX_PAYLOAD) {
+        fprintf(stderr, "'%s' doesn't compress enough\n", argv[2]);
+        return 1;
+    }
+
+    /* verify the round-trip before writing anything */
+    if (unpack(packed, packed_len, check, length) != length ||
+        !same(payload, check, length)) {
+        fprintf(stderr, "compression round-trip failed\n");
+        return 1;
+    }
+
+    /* fill in the image header */
+    sum = checksum(payload, length);
+    sectors = (packed_len + SECTOR_SIZE - 1) / SECTOR_SIZE;
+
+    boot[HDR_SECTORS] = (unsigned char)(sectors & 0xff);
+    boot[HDR_SECTORS + 1] = (unsigned char)(sectors >> 8);
+    boot[HDR_LENGTH] = (unsigned char)(length & 0xff);
+    boot[HDR_LENGTH + 1] = (unsigned char)(length >> 8);
+    boot[HDR_SUM] = (unsigned char)(sum & 0xff);
+    boot[HDR_SUM + 1] = (unsigned char)(sum >> 8);
+
+    if (write_image(argv[3], boot, packed, packed_len))
+        return 1;
+
+    printf("%s: %u -> %u bytes, %u -> %u sectors, checksum %04x\n",
+           argv[2], length, packed_len,
+           (length + SECTOR_SIZE - 1) / SECTOR_SIZE, sectors, sum);
+
+    return 0;
+}
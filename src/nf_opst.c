@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 luke8086.
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * nf_opst.c - opcode statistics
+ *
+ * Built only with NF_OPSTAT defined. nf_exec then counts executed
+ * opcodes, pairs of adjacent opcodes and CALL instructions per word,
+ * both in compiled words and in top-level statements.
+ */
+
+#include "nf_cmmn.h"
+
+#ifdef NF_OPSTAT
+
+/* opcode names, in the order of enum nf_opcode */
+static const char *nf_opstat_names[NF_OPCODE_COUNT] = {
+    "return",
+    "call",
+    "literal",
+    "branch",
+    "branch-if",
+    "branch-unless",
+    "do",
+    "loop",
+    "+loop",
+    "leave",
+    "loop-index",
+    "fetch",
+    "store",
+    "locals",
+    "local-fetch",
+    "local-store",
+    "tailcall",
+    "recurse"
+};
+
+/* local functions */
+static void nf_opstat_print(const char *name1, const char *name2,
+                            unsigned long count);
+static void nf_opstat_top(unsigned long *counts, int n, nf_cell_t top,
+                          int pairs);
+static int nf_opstat_before(struct nf_word *a, struct nf_word *b);
+
+/* clear all counters */
+void
+nf_opstat_reset(struct nf_machine *m)
+{
+    struct nf_word *w;
+    int i, j;
+
+    for (i = 0; i < NF_OPCODE_COUNT; ++i) {
+        m->op_count[i] = 0;
+
+        for (j = 0; j < NF_OPCODE_COUNT; ++j) {
+            m->op_pairs[i][j] = 0;
+        }
+    }
+
+    for (w = m->words; w; w = w->next) {
+        w->op_calls = 0;
+    }
+}
+
+/* count an instruction about to be executed, following opcode prev */
+void
+nf_opstat_count(struct nf_machine *m, int prev, struct nf_instr *i)
+{
+    int op = i->opcode;
+
+    if (op < 0 || op >= NF_OPCODE_COUNT) {
+        return;
+    }
+
+    m->op_count[op]++;
+
+    if (prev >= 0) {
+        m->op_pairs[prev][op]++;
+    }
+
+    if (op == NF_OPCODE_CALL || op == NF_OPCODE_TAILCALL) {
+        ((struct nf_word *)i->value)->op_calls++;
+    }
+}
+
+/* print a single line of the report */
+static void
+nf_opstat_print(const char *name1, const char *name2, unsigned long count)
+{
+    char buf[3 * sizeof(nf_clock_t) + 1];
+
+    (void)nf_ultoa(count, buf);
+    nf_printf("  %-16s %-16s %10s\n", name1, name2, buf);
+}
+
+/* print up to top non-zero entries of counts, starting with the highest */
+static void
+nf_opstat_top(unsigned long *counts, int n, nf_cell_t top, int pairs)
+{
+    int i, best, last = -1;
+
+    for (; top > 0; --top) {
+        best = -1;
+
+        /* select the highest entry ordered after the last one printed */
+        for (i = 0; i < n; ++i) {
+            if (!counts[i]) {
+                continue;
+            }
+
+            if (last >= 0 && (counts[i] > counts[last] ||
+                (counts[i] == counts[last] && i <= last))) {
+                continue;
+            }
+
+            if (best < 0 || counts[i] > counts[best]) {
+                best = i;
+            }
+        }
+
+        if (best < 0) {
+            break;
+        }
+
+        if (pairs) {
+            nf_opstat_print(nf_opstat_names[best / NF_OPCODE_COUNT],
+                            nf_opstat_names[best % NF_OPCODE_COUNT],
+                            counts[best]);
+        } else {
+            nf_opstat_print(nf_opstat_names[best], "", counts[best]);
+        }
+
+        last = best;
+    }
+}
+
+/* check if word a comes before b in the report */
+static int
+nf_opstat_before(struct nf_word *a, struct nf_word *b)
+{
+    if (a->op_calls != b->op_calls) {
+        return a->op_calls > b->op_calls;
+    }
+
+    return (nf_cell_t)a > (nf_cell_t)b;
+}
+
+/* 'opstat.' ( n -- ) print top n opcodes, opcode pairs and called words */
+static int
+nf_opstat_report(struct nf_machine *m)
+{
+    struct nf_word *w, *best, *last = 0;
+    nf_cell_t top, n;
+
+    if (nf_data_check(m, 1, 0))
+        return -1;
+
+    top = nf_data_pop(m);
+
+    nf_printf("opcodes:\n");
+    nf_opstat_top(m->op_count, NF_OPCODE_COUNT, top, 0);
+
+    nf_printf("opcode pairs:\n");
+    nf_opstat_top(&m->op_pairs[0][0], NF_OPCODE_COUNT * NF_OPCODE_COUNT,
+                  top, 1);
+
+    nf_printf("called words:\n");
+
+    for (n = 0; n < top; ++n) {
+        best = 0;
+
+        for (w = m->words; w; w = w->next) {
+            if (!w->op_calls || (last && !nf_opstat_before(last, w))) {
+                continue;
+            }
+
+            if (!best || nf_opstat_before(w, best)) {
+                best = w;
+            }
+        }
+
+        if (!best) {
+            break;
+        }
+
+        nf_opstat_print(best->name,
+                        best->type == NF_WORD_PRIM ? "primitive" :
+                        best->type == NF_WORD_COMP ? "compiled" : "",
+                        best->op_calls);
+        last = best;
+    }
+
+    return 0;
+}
+
+/* 'opstat-reset' ( -- ) */
+static int
+nf_opstat_reset_word(struct nf_machine *m)
+{
+    nf_opstat_reset(m);
+    return 0;
+}
+
+#define NF_DECL_PRIM(name, data) { name, NF_WORD_PRIM, data, 0 }
+
+/* append opcode statistics words to the dictionary */
+void
+nf_define_opstat_words(struct nf_machine *m)
+{
+    static struct nf_word words[] = {
+        NF_DECL_PRIM("opstat.",      (void*)nf_opstat_report),
+        NF_DECL_PRIM("opstat-reset", (void*)nf_opstat_reset_word),
+    };
+
+    int i, count;
+
+    count = sizeof(words) / sizeof(words[0]);
+
+    for (i = 0; i < count; ++i) {
+        nf_define_word(m, &words[i]);
+    }
+}
+
+#endif /* NF_OPSTAT */
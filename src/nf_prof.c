@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2026 luke8086.
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * nf_prof.c - word profiler and timing words
+ *
+ * When enabled, nf_call_word records the amount of calls, inclusive and
+ * exclusive time of every word, as measured by the platform's nf_clock.
+ *
+ * Machines made by nf_fork_machine share their words, so the counters are
+ * kept in a table of each machine, indexed by the position of the word in
+ * the dictionary. Words outside of it, like quotations, are not counted.
+ */
+
+#include "nf_cmmn.h"
+
+/* entries added to the table of counters when it's too short */
+#define NF_PROF_SLACK 32
+
+/* local functions */
+static void nf_prof_clear(struct nf_prof_count *c, unsigned n);
+static struct nf_prof_count *nf_prof_get(struct nf_machine *m,
+                                         struct nf_word *w);
+static int nf_prof_before(struct nf_machine *m, struct nf_word *a,
+                          struct nf_word *b);
+static void nf_prof_print(struct nf_word *w, struct nf_prof_count *c);
+static int nf_prof_target(struct nf_machine *m, struct nf_word **w);
+static int nf_prof_run(struct nf_machine *m, struct nf_word *w);
+
+/* reset n counters */
+static void
+nf_prof_clear(struct nf_prof_count *c, unsigned n)
+{
+    unsigned i;
+
+    for (i = 0; i < n; ++i) {
+        c[i].calls = 0;
+        c[i].time_incl = 0;
+        c[i].time_excl = 0;
+    }
+}
+
+/*
+ * return the counters of a word, growing the table when the dictionary has
+ * grown past it. return 0 if w is not in the dictionary, or there's not
+ * enough memory
+ */
+struct nf_prof_count *
+nf_prof_count(struct nf_machine *m, struct nf_word *w)
+{
+    struct nf_prof_count *c;
+    unsigned size;
+
+    if (!w->id) {
+        return 0;
+    }
+
+    if (w->id >= m->prof_size) {
+        size = w->id + NF_PROF_SLACK;
+
+        c = nf_malloc(size * sizeof(struct nf_prof_count));
+        if (!c) {
+            return 0;
+        }
+
+        nf_prof_clear(c, size);
+
+        if (m->prof_counts) {
+            nf_memcpy(c, m->prof_counts,
+                      m->prof_size * sizeof(struct nf_prof_count));
+            nf_free(m->prof_counts);
+        }
+
+        m->prof_counts = c;
+        m->prof_size = size;
+    }
+
+    return &m->prof_counts[w->id];
+}
+
+/* return the counters of a word, or 0 if it was never counted */
+static struct nf_prof_count *
+nf_prof_get(struct nf_machine *m, struct nf_word *w)
+{
+    if (!w->id || w->id >= m->prof_size) {
+        return 0;
+    }
+
+    return &m->prof_counts[w->id];
+}
+
+/* 'profile-on' ( -- ) */
+static int
+nf_prof_on(struct nf_machine *m)
+{
+    /* make room for the words defined so far */
+    if (m->words && !nf_prof_count(m, m->words)) {
+        nf_error(("out of memory"));
+        return -1;
+    }
+
+    m->profile = 1;
+    return 0;
+}
+
+/* 'profile-off' ( -- ) */
+static int
+nf_prof_off(struct nf_machine *m)
+{
+    m->profile = 0;
+    return 0;
+}
+
+/* 'profile-reset' ( -- ) */
+static int
+nf_prof_reset(struct nf_machine *m)
+{
+    nf_prof_clear(m->prof_counts, m->prof_size);
+
+    return 0;
+}
+
+/*
+ * check if word a comes before b in the report, ordered by exclusive time.
+ * both were counted
+ */
+static int
+nf_prof_before(struct nf_machine *m, struct nf_word *a, struct nf_word *b)
+{
+    nf_clock_t ta = nf_prof_get(m, a)->time_excl;
+    nf_clock_t tb = nf_prof_get(m, b)->time_excl;
+
+    if (ta != tb) {
+        return ta > tb;
+    }
+
+    return (nf_cell_t)a > (nf_cell_t)b;
+}
+
+/* print a single line of the report */
+static void
+nf_prof_print(struct nf_word *w, struct nf_prof_count *c)
+{
+    char calls[3 * sizeof(nf_clock_t) + 1];
+    char incl[3 * sizeof(nf_clock_t) + 1];
+    char excl[3 * sizeof(nf_clock_t) + 1];
+
+    (void)nf_ultoa(c->calls, calls);
+    (void)nf_ultoa(nf_clock_to_us(c->time_incl), incl);
+    (void)nf_ultoa(nf_clock_to_us(c->time_excl), excl);
+
+    nf_printf("%-16s %10s %12s %12s\n", w->name, calls, incl, excl);
+}
+
+/*
+ * 'profile.' ( -- )
+ * print words which were called since the last reset, starting with the
+ * longest exclusive time. words are selected one by one, to avoid
+ * allocating memory for sorting.
+ */
+static int
+nf_prof_report(struct nf_machine *m)
+{
+    struct nf_word *w, *best, *last = 0;
+    struct nf_prof_count *c;
+
+    nf_printf("%-16s %10s %12s %12s\n", "word", "calls", "incl (us)", "excl (us)");
+
+    for (;;) {
+        best = 0;
+
+        for (w = m->words; w; w = w->next) {
+            c = nf_prof_get(m, w);
+
+            if (!c || !c->calls || (last && !nf_prof_before(m, last, w))) {
+                continue;
+            }
+
+            if (!best || nf_prof_before(m, w, best)) {
+                best = w;
+            }
+        }
+
+        if (!best) {
+            break;
+        }
+
+        nf_prof_print(best, nf_prof_get(m, best));
+        last = best;
+    }
+
+    return 0;
+}
+
+/*
+ * pop the name of a word to measure. 0 stands for the compilation buffer,
+ * as executed by 'exec'. return 0 on success
+ */
+static int
+nf_prof_target(struct nf_machine *m, struct nf_word **w)
+{
+    char *name;
+
+    if (nf_data_check(m, 1, 0))
+        return -1;
+
+    name = (char *)nf_data_pop(m);
+    *w = 0;
+
+    if (name) {
+        *w = nf_lookup_word(m, name);
+        if (!*w) {
+            nf_error(("unknown word"));
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/* execute a word, or the compilation buffer if w is 0 */
+static int
+nf_prof_run(struct nf_machine *m, struct nf_word *w)
+{
+    return w ? nf_call_word(m, w) : nf_exec(m, m->comp_buf);
+}
+
+/* 'time' ( s -- ) execute word named s, or comp_buf if s is 0, and print the time */
+static int
+nf_prof_time(struct nf_machine *m)
+{
+    struct nf_word *w;
+    nf_clock_t start, elapsed;
+    char buf[3 * sizeof(nf_clock_t) + 1];
+    int ret;
+
+    if (nf_prof_target(m, &w))
+        return -1;
+
+    start = nf_clock();
+    ret = nf_prof_run(m, w);
+    elapsed = nf_clock() - start;
+
+    (void)nf_ultoa(nf_clock_to_us(elapsed), buf);
+    nf_printf("%s us\n", buf);
+
+    return ret;
+}
+
+/*
+ * 'bench' ( s n -- ) execute word named s, or comp_buf if s is 0, n times
+ * and print the time per iteration. the time of calling an empty word the
+ * same amount of times is subtracted, and the data stack is restored after
+ * every iteration.
+ */
+static int
+nf_prof_bench(struct nf_machine *m)
+{
+    static struct nf_instr empty_code[] = { { NF_OPCODE_RETURN, 0 } };
+    static struct nf_word empty = { "", NF_WORD_COMP, empty_code, 0 };
+
+    struct nf_word *w;
+    nf_cell_t n, k, *sp;
+    nf_clock_t start, elapsed, overhead, us;
+    char buf[3 * sizeof(nf_clock_t) + 1];
+
+    if (nf_data_check(m, 2, 0))
+        return -1;
+
+    n = nf_data_pop(m);
+
+    if (n <= 0) {
+        nf_error(("invalid iteration count"));
+        return -1;
+    }
+
+    if (nf_prof_target(m, &w))
+        return -1;
+
+    sp = m->data_sp;
+
+    /* measure the loop with an empty word first */
+    start = nf_clock();
+    for (k = 0; k < n; ++k) {
+        (void)nf_call_word(m, &empty);
+    }
+    overhead = nf_clock() - start;
+
+    start = nf_clock();
+    for (k = 0; k < n; ++k) {
+        if (nf_prof_run(m, w)) {
+            m->data_sp = sp;
+            return -1;
+        }
+        m->data_sp = sp;
+    }
+    elapsed = nf_clock() - start;
+
+    elapsed = (elapsed > overhead) ? elapsed - overhead : 0;
+    us = nf_clock_to_us(elapsed);
+
+    /* print nanoseconds per iteration, unless that would overflow */
+    if (us < (nf_clock_t)-1 / 1000) {
+        (void)nf_ultoa(us * 1000 / (nf_clock_t)n, buf);
+        nf_printf("%s ns per iteration\n", buf);
+    } else {
+        (void)nf_ultoa(us / (nf_clock_t)n, buf);
+        nf_printf("%s us per iteration\n", buf);
+    }
+
+    return 0;
+}
+
+#define NF_DECL_PRIM(name, data) { name, NF_WORD_PRIM, data, 0 }
+
+/* append profiler words to the dictionary */
+void
+nf_define_prof_words(struct nf_machine *m)
+{
+    static struct nf_word words[] = {
+        NF_DECL_PRIM("profile-on",    (void*)nf_prof_on),
+        NF_DECL_PRIM("profile-off",   (void*)nf_prof_off),
+        NF_DECL_PRIM("profile-reset", (void*)nf_prof_reset),
+        NF_DECL_PRIM("profile.",      (void*)nf_prof_report),
+        NF_DECL_PRIM("time",          (void*)nf_prof_time),
+        NF_DECL_PRIM("bench",         (void*)nf_prof_bench),
+    };
+
+    int i, count;
+
+    count = sizeof(words) / sizeof(words[0]);
+
+    for (i = 0; i < count; ++i) {
+        nf_define_word(m, &words[i]);
+    }
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026 luke8086.
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * nf_snap.c - prebuilt dictionary snapshots
+ *
+ * A snapshot is the heap area allocated while interpreting the init code,
+ * i.e. the words it defined, their bytecode, strings and the buffers it
+ * allotted. To find out which cells of the area are pointers into it, the
+ * init code is interpreted twice at different heap addresses, and cells
+ * which differ by exactly the distance between both runs are recorded as
+ * relocations. Pointers to built-in words are stored as is, so a snapshot
+ * can only be loaded into the same build which created it.
+ *
+ * This relies on nf_malloc being a bump allocator, where nf_malloc(0)
+ * returns the top of the heap. Both runs start with an empty block cache,
+ * since reusing blocks compiled by the first run would allocate less.
+ */
+
+#include "nf_cmmn.h"
+
+/* snapshot header, followed by the image and relocation offsets */
+struct nf_snap_hdr {
+    char magic[4];
+    size_t size;
+    size_t relocs;
+    size_t words;
+    size_t bufs;
+    nf_cell_t base;
+    nf_cell_t builtins;
+};
+
+static const char nf_snap_magic[4] = { 'N', 'F', 'S', '2' };
+
+/* local functions */
+static size_t nf_snap_diff(char *img1, char *img2, size_t size,
+                           nf_cell_t delta, size_t *relocs);
+static size_t nf_snap_bufs(struct nf_machine *m, struct nf_buf *bufs,
+                           char *img);
+
+/*
+ * compare images created at addresses differing by delta. if relocs is
+ * not null, store offsets of the relocated cells. return the amount of
+ * relocations or -1 if the images differ otherwise.
+ */
+static size_t
+nf_snap_diff(char *img1, char *img2, size_t size, nf_cell_t delta,
+             size_t *relocs)
+{
+    size_t i, n = 0;
+
+    for (i = 0; i < size; ++i) {
+        if (img1[i] == img2[i]) {
+            continue;
+        }
+
+        /* delta is not a multiple of 256, so pointers differ on the first byte */
+        if (size - i < sizeof(nf_cell_t) ||
+            *(nf_cell_t *)(img2 + i) - *(nf_cell_t *)(img1 + i) != delta) {
+            return (size_t)-1;
+        }
+
+        if (relocs) {
+            relocs[n] = i;
+        }
+
+        ++n;
+        i += sizeof(nf_cell_t) - 1;
+    }
+
+    return n;
+}
+
+/*
+ * return the offset of the latest buffer in an image, or -1 if the init
+ * code didn't allot any, and the list still starts with bufs
+ */
+static size_t
+nf_snap_bufs(struct nf_machine *m, struct nf_buf *bufs, char *img)
+{
+    return (m->bufs == bufs) ? (size_t)-1 : (size_t)((char *)m->bufs - img);
+}
+
+/*
+ * interpret init code and create a snapshot of the words it defined.
+ * on success, return pointer to the snapshot and store its length in len.
+ * on failure, display an error and return 0.
+ */
+char *
+nf_snap_create(struct nf_machine *m, const char *code, const char *end,
+               size_t *len)
+{
+    struct nf_snap_hdr hdr;
+    struct nf_word *builtins = m->words;
+    struct nf_buf *bufs = m->bufs;
+    char *img1, *img2, *ret;
+    size_t size, pad;
+    nf_cell_t delta;
+
+    /* first run */
+    nf_block_reset(m);
+    img1 = nf_malloc(0);
+    (void)nf_intp_text(m, code, end);
+    size = (char *)nf_malloc(0) - img1;
+    hdr.words = (char *)m->words - img1;
+    hdr.bufs = nf_snap_bufs(m, bufs, img1);
+
+    /* second run, at an offset which is not a multiple of 256 */
+    m->words = builtins;
+    m->bufs = bufs;
+    m->data_sp = m->data_stack;
+    nf_block_reset(m);
+
+    pad = ((size & 0xff) == 0xff) ? 2 : 1;
+    (void)nf_malloc(pad);
+
+    img2 = nf_malloc(0);
+    (void)nf_intp_text(m, code, end);
+    delta = img2 - img1;
+
+    if ((char *)m->words < img2 || hdr.words >= size) {
+        nf_error(("init code doesn't define any words"));
+        return 0;
+    }
+
+    if ((size_t)((char *)nf_malloc(0) - img2) != size ||
+        (size_t)((char *)m->words - img2) != hdr.words ||
+        nf_snap_bufs(m, bufs, img2) != hdr.bufs) {
+        nf_error(("init code is not deterministic"));
+        return 0;
+    }
+
+    hdr.relocs = nf_snap_diff(img1, img2, size, delta, 0);
+    if (hdr.relocs == (size_t)-1) {
+        nf_error(("init code is not deterministic"));
+        return 0;
+    }
+
+    *len = sizeof(hdr) + size + hdr.relocs * sizeof(size_t);
+    ret = nf_malloc(*len);
+    if (!ret) {
+        nf_error(("out of memory"));
+        return 0;
+    }
+
+    nf_memcpy(hdr.magic, nf_snap_magic, sizeof(hdr.magic));
+    hdr.size = size;
+    hdr.base = (nf_cell_t)img1;
+    hdr.builtins = (nf_cell_t)builtins;
+
+    nf_memcpy(ret, &hdr, sizeof(hdr));
+    nf_memcpy(ret + sizeof(hdr), img1, size);
+    (void)nf_snap_diff(img1, img2, size, delta,
+                       (size_t *)(ret + sizeof(hdr) + size));
+
+    return ret;
+}
+
+/*
+ * map a snapshot into the machine, in place of interpreting the init code.
+ * return 0 on success or -1 if the snapshot is missing or doesn't match
+ * this build.
+ */
+int
+nf_snap_load(struct nf_machine *m, const char *snap, const char *end)
+{
+    struct nf_snap_hdr hdr;
+    const size_t *relocs;
+    char *img;
+    nf_cell_t delta;
+    size_t i;
+
+    if ((size_t)(end - snap) < sizeof(hdr)) {
+        return -1;
+    }
+
+    nf_memcpy(&hdr, snap, sizeof(hdr));
+
+    if (nf_memcmp(hdr.magic, nf_snap_magic, sizeof(hdr.magic)) ||
+        hdr.builtins != (nf_cell_t)m->words ||
+        (size_t)(end - snap) != sizeof(hdr) + hdr.size +
+                                hdr.relocs * sizeof(size_t)) {
+        return -1;
+    }
+
+    img = nf_malloc(hdr.size);
+    if (!img) {
+        return -1;
+    }
+
+    nf_memcpy(img, snap + sizeof(hdr), hdr.size);
+
+    /* fix up pointers for the new location */
+    delta = img - (char *)hdr.base;
+    relocs = (const size_t *)(snap + sizeof(hdr) + hdr.size);
+
+    for (i = 0; i < hdr.relocs; ++i) {
+        *(nf_cell_t *)(img + relocs[i]) += delta;
+    }
+
+    m->words = (struct nf_word *)(img + hdr.words);
+
+    /* the first buffer links to the ones of the machine, none so far */
+    if (hdr.bufs != (size_t)-1) {
+        m->bufs = (struct nf_buf *)(img + hdr.bufs);
+    }
+
+    return 0;
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 luke8086.
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * nf_stat.c - memory usage statistics
+ *
+ * The machine keeps high-water marks of its stacks and the compilation
+ * buffer. Heap and C stack usage come from the platform, where the C stack
+ * peak is measured by painting the free memory (not in hosted builds).
+ */
+
+#include "nf_cmmn.h"
+
+/* set high-water marks to the current usage */
+void
+nf_stat_reset(struct nf_machine *m)
+{
+    m->data_peak = m->data_sp - m->data_stack;
+    m->stmt_peak = m->stmt_sp - m->stmt_stack;
+    m->comp_peak = m->comp_ip - m->comp_buf;
+
+    nf_stack_paint();
+}
+
+/* 'stats' ( -- ) */
+static int
+nf_stat_print(struct nf_machine *m)
+{
+    size_t stack = nf_stack_peak();
+    size_t heap_free = nf_heap_free();
+
+    nf_printf("data stack    %5u peak %5u of %u cells\n",
+              (unsigned)(m->data_sp - m->data_stack),
+              (unsigned)m->data_peak, (unsigned)NF_DATA_STACK_SIZE);
+
+    nf_printf("stmt stack    %5u peak %5u of %u\n",
+              (unsigned)(m->stmt_sp - m->stmt_stack),
+              (unsigned)m->stmt_peak, (unsigned)NF_STMT_STACK_SIZE);
+
+    nf_printf("comp buffer   %5u peak %5u of %u instructions\n",
+              (unsigned)(m->comp_ip - m->comp_buf),
+              (unsigned)m->comp_peak, (unsigned)NF_COMP_BUF_SIZE);
+
+    nf_printf("heap          %5u bytes", (unsigned)nf_heap_used());
+
+    if (heap_free) {
+        nf_printf(", %u free", (unsigned)heap_free);
+    }
+
+    nf_printf("\n");
+
+    if (stack == (size_t)-1) {
+        nf_printf("C stack             reached the heap!\n");
+    } else if (stack) {
+        nf_printf("C stack             peak %5u bytes\n", (unsigned)stack);
+    }
+
+    return 0;
+}
+
+/* 'stats-reset' ( -- ) */
+static int
+nf_stat_reset_word(struct nf_machine *m)
+{
+    nf_stat_reset(m);
+    return 0;
+}
+
+#define NF_DECL_PRIM(name, data) { name, NF_WORD_PRIM, data, 0 }
+
+/* append statistics words to the dictionary */
+void
+nf_define_stat_words(struct nf_machine *m)
+{
+    static struct nf_word words[] = {
+        NF_DECL_PRIM("stats",       (void*)nf_stat_print),
+        NF_DECL_PRIM("stats-reset", (void*)nf_stat_reset_word),
+    };
+
+    int i, count;
+
+    count = sizeof(words) / sizeof(words[0]);
+
+    for (i = 0; i < count; ++i) {
+        nf_define_word(m, &words[i]);
+    }
+}
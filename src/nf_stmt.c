@@ -9,6 +9,16 @@
 
 #include "nf_cmmn.h"
 
+/* finish a top-level statement, cache its bytecode and exec it */
+static int
+nf_stmt_exec(struct nf_machine *m)
+{
+    nf_comp_finish(m);
+    nf_block_store(m);
+
+    return nf_exec(m, m->comp_buf);
+}
+
 /* ':' ( -- ':' ) */
 static int
 nf_stmt_colon(struct nf_machine *m)
@@ -59,6 +69,11 @@ nf_stmt_if(struct nf_machine *m)
 
     /* if interpreting, compile until 'then' and automatically exec */
     if (m->state != NF_STATE_COMPILE) {
+        /* unless the same block was compiled before, see nf_blkc.c */
+        if (nf_block_find(m, "if")) {
+            return nf_exec(m, m->comp_buf);
+        }
+
         nf_comp_start(m);
     }
 
@@ -139,12 +154,7 @@ nf_stmt_then(struct nf_machine *m)
     }
 
     /* finish compilation and exec the bytecode */
-    nf_comp_finish(m);
-    if (nf_exec(m, m->comp_buf)) {
-        return -1;
-    }
-
-    return 0;
+    return nf_stmt_exec(m);
 }
 
 /* 'begin' ( -- 'begin' ) */
@@ -153,6 +163,11 @@ nf_stmt_begin(struct nf_machine *m)
 {
     /* if interpreting, compile up to 'until' or 'repeat' and exec */
     if (m->state != NF_STATE_COMPILE) {
+        /* unless the same block was compiled before, see nf_blkc.c */
+        if (nf_block_find(m, "begin")) {
+            return nf_exec(m, m->comp_buf);
+        }
+
         nf_comp_start(m);
     }
 
@@ -238,12 +253,7 @@ nf_stmt_repeat(struct nf_machine *m)
     }
 
     /* finish compilation and exec the bytecode */
-    nf_comp_finish(m);
-    if (nf_exec(m, m->comp_buf)) {
-        return -1;
-    }
-
-    return 0;
+    return nf_stmt_exec(m);
 }
 
 /* 'until' word */
@@ -277,8 +287,414 @@ nf_stmt_until(struct nf_machine *m)
     }
 
     /* finish compilation and exec the bytecode */
-    nf_comp_finish(m);
-    if (nf_exec(m, m->comp_buf)) {
+    return nf_stmt_exec(m);
+}
+
+/* 'do' ( -- 'do' ) */
+static int
+nf_stmt_do(struct nf_machine *m)
+{
+    struct nf_instr *i;
+
+    /* if interpreting, compile up to 'loop' or '+loop' and exec */
+    if (m->state != NF_STATE_COMPILE) {
+        /* unless the same block was compiled before, see nf_blkc.c */
+        if (nf_block_find(m, "do")) {
+            return nf_exec(m, m->comp_buf);
+        }
+
+        nf_comp_start(m);
+    }
+
+    /* insert a do instruction, to be pointed past the loop by 'loop' */
+    i = nf_comp_instr(m, NF_OPCODE_DO, 0);
+    if (!i) {
+        nf_error(("compilation buffer overflow"));
+        return -1;
+    }
+
+    if (nf_stmt_push(m, NF_STMT_DO, i)) {
+        nf_error(("statement stack overflow"));
+        return -1;
+    };
+
+    return 0;
+}
+
+/* finish a counted loop with a given loop instruction */
+static int
+nf_stmt_loop_end(struct nf_machine *m, enum nf_opcode opcode)
+{
+    struct nf_stmt *s;
+
+    if (m->state != NF_STATE_COMPILE) {
+        nf_error(("syntax error"));
+        return -1;
+    }
+
+    s = nf_stmt_pop(m);
+    if (!s || s->type != NF_STMT_DO) {
+        nf_error(("syntax error"));
+        return -1;
+    }
+
+    /* branch back to the instruction following 'do' */
+    if (!nf_comp_instr(m, opcode, s->ip + 1 - m->comp_ip)) {
+        nf_error(("compilation buffer overflow"));
+        return -1;
+    };
+
+    /* point 'do' past the loop, for 'leave' */
+    s->ip->value = m->comp_ip - s->ip;
+
+    /* if the statement stack is not empty, continue compilation */
+    if (nf_stmt_count(m)) {
+        return 0;
+    }
+
+    /* finish compilation and exec the bytecode */
+    return nf_stmt_exec(m);
+}
+
+/* 'loop' ( 'do' -- ) */
+static int
+nf_stmt_loop(struct nf_machine *m)
+{
+    return nf_stmt_loop_end(m, NF_OPCODE_LOOP);
+}
+
+/* '+loop' ( 'do' -- ) */
+static int
+nf_stmt_plus_loop(struct nf_machine *m)
+{
+    return nf_stmt_loop_end(m, NF_OPCODE_PLUS_LOOP);
+}
+
+/* 'leave' word */
+static int
+nf_stmt_leave(struct nf_machine *m)
+{
+    struct nf_stmt *s;
+    size_t n = 0;
+
+    if (m->state != NF_STATE_COMPILE) {
+        nf_error(("syntax error"));
+        return -1;
+    }
+
+    /* find the innermost 'do', which can't be outside of a quotation */
+    while ((s = nf_stmt_get(m, n)) != 0 && s->type != NF_STMT_DO &&
+           s->type != NF_STMT_QUOT) {
+        ++n;
+    }
+
+    if (!s || s->type != NF_STMT_DO) {
+        nf_error(("syntax error"));
+        return -1;
+    }
+
+    /* jump to 'do', which will point past the loop */
+    if (!nf_comp_instr(m, NF_OPCODE_LEAVE, s->ip - m->comp_ip)) {
+        nf_error(("compilation buffer overflow"));
+        return -1;
+    };
+
+    return 0;
+}
+
+/* compile pushing the index of a loop, nested depth levels out */
+static int
+nf_stmt_index(struct nf_machine *m, int depth)
+{
+    if (m->state != NF_STATE_COMPILE) {
+        nf_error(("syntax error"));
+        return -1;
+    }
+
+    if (!nf_comp_instr(m, NF_OPCODE_LOOP_INDEX, depth)) {
+        nf_error(("compilation buffer overflow"));
+        return -1;
+    };
+
+    return 0;
+}
+
+/* 'i' ( -- n ) */
+static int
+nf_stmt_i(struct nf_machine *m)
+{
+    return nf_stmt_index(m, 0);
+}
+
+/* 'j' ( -- n ) */
+static int
+nf_stmt_j(struct nf_machine *m)
+{
+    return nf_stmt_index(m, 1);
+}
+
+/* '{' ( -- ) declare locals, up to '}', at the start of a definition */
+static int
+nf_stmt_locals(struct nf_machine *m)
+{
+    struct nf_stmt *s = nf_stmt_get(m, 0);
+
+    if (m->state != NF_STATE_COMPILE || nf_stmt_count(m) != 1 ||
+        s->type != NF_STMT_COLON || s->ip != m->comp_ip || m->local_count) {
+        nf_error(("syntax error"));
+        return -1;
+    }
+
+    m->local_decl = 1;
+
+    return 0;
+}
+
+/* 'recurse' ( -- ) call the word or quotation being defined */
+static int
+nf_stmt_recurse(struct nf_machine *m)
+{
+    struct nf_stmt *s;
+    size_t n = 0;
+
+    if (m->state != NF_STATE_COMPILE) {
+        nf_error(("syntax error"));
+        return -1;
+    }
+
+    /* find the innermost quotation, or the definition */
+    while ((s = nf_stmt_get(m, n)) != 0 && s->type != NF_STMT_QUOT) {
+        ++n;
+    }
+
+    if (!s) {
+        s = m->stmt_stack;
+
+        if (!nf_stmt_count(m) || s->type != NF_STMT_COLON) {
+            nf_error(("syntax error"));
+            return -1;
+        }
+    }
+
+    /* the word has no name yet, so refer to the start of its code */
+    if (!nf_comp_instr(m, NF_OPCODE_RECURSE, s->ip - m->comp_ip)) {
+        nf_error(("compilation buffer overflow"));
+        return -1;
+    }
+
+    return 0;
+}
+
+/* ':=' executed by compiled code, looking the variable up by name */
+static int
+nf_stmt_assign_run(struct nf_machine *m)
+{
+    nf_cell_t *cell;
+    nf_cell_t val;
+    char *name;
+
+    if (nf_data_check(m, 2, 0))
+        return -1;
+
+    name = (char *)nf_data_pop(m);
+    val = nf_data_pop(m);
+
+    cell = nf_var_cell(m, name);
+    if (!cell) {
+        return -1;
+    }
+
+    *cell = val;
+
+    return 0;
+}
+
+static struct nf_word nf_stmt_assign_word = {
+    ":=", NF_WORD_PRIM, (void*)nf_stmt_assign_run, 0
+};
+
+/* ':=' ( n s -- ) */
+static int
+nf_stmt_assign(struct nf_machine *m)
+{
+    struct nf_instr *i = m->comp_ip - 1;
+    struct nf_word *w;
+    nf_cell_t *cell;
+    int local;
+
+    if (m->state != NF_STATE_COMPILE) {
+        return nf_stmt_assign_run(m);
+    }
+
+    /* if the name is a literal no branch jumps to, store directly into it */
+    if (i == m->comp_str && i >= m->comp_mark) {
+        local = nf_comp_local(m, (char *)i->value);
+
+        /* quotations run in a frame of their own */
+        if (local >= 0 && m->quot_depth) {
+            nf_error(("local in quotation"));
+            return -1;
+        }
+
+        if (local >= 0) {
+            i->opcode = NF_OPCODE_LOCAL_STORE;
+            i->value = local;
+            m->comp_str = 0;
+            --m->block_strs;
+
+            return 0;
+        }
+
+        w = nf_lookup_word(m, (char *)i->value);
+
+        if (w && w->type == NF_WORD_VAR) {
+            cell = nf_var_cell(m, w->name);
+            if (!cell) {
+                return -1;
+            }
+
+            i->opcode = NF_OPCODE_STORE;
+            i->value = (nf_cell_t)cell;
+            m->comp_str = 0;
+            --m->block_strs;
+
+            return 0;
+        }
+    }
+
+    /* otherwise look it up on every execution */
+    if (!nf_comp_instr(m, NF_OPCODE_CALL, (nf_cell_t)&nf_stmt_assign_word)) {
+        nf_error(("compilation buffer overflow"));
+        return -1;
+    }
+
+    return 0;
+}
+
+/* '[' ( -- '[' ) start a quotation */
+static int
+nf_stmt_quot(struct nf_machine *m)
+{
+    /* if interpreting, compile until ']' and push its token */
+    if (m->state != NF_STATE_COMPILE) {
+        nf_comp_start(m);
+    }
+
+    if (nf_stmt_push(m, NF_STMT_QUOT, m->comp_ip)) {
+        nf_error(("statement stack overflow"));
+        return -1;
+    };
+
+    ++m->quot_depth;
+
+    return 0;
+}
+
+/* ']' ( '[' -- ) finish a quotation, as an anonymous word */
+static int
+nf_stmt_quot_end(struct nf_machine *m)
+{
+    struct nf_instr *code;
+    struct nf_stmt *s;
+    struct nf_word *w;
+
+    if (m->state != NF_STATE_COMPILE) {
+        nf_error(("syntax error"));
+        return -1;
+    }
+
+    s = nf_stmt_pop(m);
+    if (!s || s->type != NF_STMT_QUOT) {
+        nf_error(("syntax error"));
+        return -1;
+    }
+
+    --m->quot_depth;
+
+    code = nf_comp_quot(m, s->ip);
+    if (!code) {
+        return -1;
+    }
+
+    w = nf_init_word(m, "[quotation]", NF_WORD_COMP, code);
+    if (!w) {
+        nf_error(("out of memory"));
+        return -1;
+    }
+
+    /* at top level, push the token */
+    if (!nf_stmt_count(m)) {
+        m->state = NF_STATE_INTERPRET;
+
+        if (nf_data_check(m, 0, 1))
+            return -1;
+        nf_data_push(m, (nf_cell_t)w);
+
+        return 0;
+    }
+
+    /* otherwise, compile it as a literal */
+    if (!nf_comp_instr(m, NF_OPCODE_LITERAL, (nf_cell_t)w)) {
+        nf_error(("compilation buffer overflow"));
+        return -1;
+    }
+
+    return 0;
+}
+
+/* tick executed by compiled code, looking the word up by name */
+static int
+nf_stmt_tick_run(struct nf_machine *m)
+{
+    struct nf_word *w;
+
+    if (nf_data_check(m, 1, 1))
+        return -1;
+
+    w = nf_lookup_word(m, (char *)nf_data_pop(m));
+    if (!w) {
+        nf_error(("unknown word"));
+        return -1;
+    }
+
+    nf_data_push(m, (nf_cell_t)w);
+
+    return 0;
+}
+
+static struct nf_word nf_stmt_tick_word = {
+    "'", NF_WORD_PRIM, (void*)nf_stmt_tick_run, 0
+};
+
+/* tick ( s -- xt ) push the token of a word, for 'execute' */
+static int
+nf_stmt_tick(struct nf_machine *m)
+{
+    struct nf_instr *i = m->comp_ip - 1;
+    struct nf_word *w;
+
+    if (m->state != NF_STATE_COMPILE) {
+        return nf_stmt_tick_run(m);
+    }
+
+    /* if no branch jumps to the name literal, replace it with the token */
+    if (i == m->comp_str && i >= m->comp_mark) {
+        w = nf_lookup_word(m, (char *)i->value);
+        if (!w) {
+            nf_error(("unknown word"));
+            return -1;
+        }
+
+        i->value = (nf_cell_t)w;
+        m->comp_str = 0;
+        --m->block_strs;
+
+        return 0;
+    }
+
+    /* otherwise look it up on every execution */
+    if (!nf_comp_instr(m, NF_OPCODE_CALL, (nf_cell_t)&nf_stmt_tick_word)) {
+        nf_error(("compilation buffer overflow"));
         return -1;
     }
 
@@ -301,6 +717,18 @@ nf_define_stmt_words(struct nf_machine *m)
         NF_DECL_STMT("repeat", (void*)nf_stmt_repeat),
         NF_DECL_STMT("while", (void*)nf_stmt_while),
         NF_DECL_STMT("until", (void*)nf_stmt_until),
+        NF_DECL_STMT("do", (void*)nf_stmt_do),
+        NF_DECL_STMT("loop", (void*)nf_stmt_loop),
+        NF_DECL_STMT("+loop", (void*)nf_stmt_plus_loop),
+        NF_DECL_STMT("leave", (void*)nf_stmt_leave),
+        NF_DECL_STMT("i", (void*)nf_stmt_i),
+        NF_DECL_STMT("j", (void*)nf_stmt_j),
+        NF_DECL_STMT(":=", (void*)nf_stmt_assign),
+        NF_DECL_STMT("{", (void*)nf_stmt_locals),
+        NF_DECL_STMT("recurse", (void*)nf_stmt_recurse),
+        NF_DECL_STMT("[", (void*)nf_stmt_quot),
+        NF_DECL_STMT("]", (void*)nf_stmt_quot_end),
+        NF_DECL_STMT("'", (void*)nf_stmt_tick),
     };
 
     int i, count;
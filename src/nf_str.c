@@ -5,61 +5,269 @@
 
 /*
  * nf_str.c - string manipulation
+ *
+ * The primitives (nf_memcpy, nf_memcmp, nf_memchr, nf_strlen, nf_strcmp)
+ * are provided by the platform, with the string instructions in DOS and
+ * the C library in hosted builds. Everything else here is built on them,
+ * so that no loop goes through a string byte by byte in C.
  */
 
 #include "nf_cmmn.h"
 
-/* copy memory area */
-void *
-nf_memcpy(void *dest, const void *src, size_t n)
+/* copy a string */
+char *
+nf_strncpy(char *dest, const char *src, size_t n)
 {
-    unsigned char *srcb = (unsigned char *)src;
-    unsigned char *destb = (unsigned char *)dest;
+    const char *end = nf_memchr(src, 0, n);
+    size_t len = end ? (size_t)(end - src) : n;
 
-    while (n--) {
-        *(destb++) = *(srcb++);
+    nf_memcpy(dest, src, len);
+
+    while (len < n) {
+        dest[len++] = '\0';
     }
 
     return dest;
 }
 
-/* calculate the length of a string */
+/* find the first occurrence of s2 in s1 */
+char *
+nf_strstr(const char *s1, const char *s2)
+{
+    size_t n = nf_strlen(s2);
+    const char *end = s1 + nf_strlen(s1);
+
+    if (!n) {
+        return (char *)s1;
+    }
+
+    /* find candidates by the first character, then compare the rest */
+    while ((size_t)(end - s1) >= n) {
+        s1 = nf_memchr(s1, s2[0], (size_t)(end - s1) - n + 1);
+        if (!s1) {
+            return 0;
+        }
+
+        if (!nf_memcmp(s1 + 1, s2 + 1, n - 1)) {
+            return (char *)s1;
+        }
+
+        ++s1;
+    }
+
+    return 0;
+}
+
+/* format an unsigned clock value in decimal, return the amount of characters */
 size_t
-nf_strlen(const char *s1)
+nf_ultoa(nf_clock_t n, char *buf)
 {
-    size_t ret = 0;
+    char tmp[3 * sizeof(nf_clock_t) + 1];
+    size_t i = 0, len = 0;
+
+    /* save digits to the temporary buffer in a reverse order */
+    do {
+        tmp[i++] = (char)('0' + n % 10);
+        n /= 10;
+    } while (n);
 
-    while (*s1++) {
-        ++ret;
+    while (i) {
+        buf[len++] = tmp[--i];
     }
 
-    return ret;
+    buf[len] = 0;
+
+    return len;
 }
 
-/* compare two strings */
-int
-nf_strcmp(const char *s1, const char *s2)
+/* format a signed integer in decimal, return the amount of characters */
+size_t
+nf_itoa(nf_cell_t n, char *buf)
 {
-    while (*s1 && (*s1 == *s2)) {
-        ++s1;
-        ++s2;
+    char tmp[3 * sizeof(nf_cell_t) + 1];
+    uintmax_t u = (n < 0) ? 0 - (uintmax_t)n : (uintmax_t)n;
+    size_t i = 0, len = 0;
+
+    /* save digits to the temporary buffer in a reverse order */
+    do {
+        tmp[i++] = (char)('0' + u % 10);
+        u /= 10;
+    } while (u);
+
+    if (n < 0) {
+        buf[len++] = '-';
     }
-    return (*s1 - *s2);
+
+    while (i) {
+        buf[len++] = tmp[--i];
+    }
+
+    buf[len] = 0;
+
+    return len;
 }
 
-/* copy a string */
-char *
-nf_strncpy(char *dest, const char *src, size_t n)
+/* 'strlen' ( s -- n ) */
+static int
+nf_str_len(struct nf_machine *m)
+{
+    nf_cell_t s;
+
+    if (nf_data_check(m, 1, 1))
+        return -1;
+
+    s = nf_data_pop(m);
+    nf_data_push(m, (nf_cell_t)nf_strlen((const char *)s));
+
+    return 0;
+}
+
+/* 'strcmp' ( s1 s2 -- r ) r is -1, 0 or 1 */
+static int
+nf_str_cmp(struct nf_machine *m)
+{
+    nf_cell_t s1, s2;
+    int r;
+
+    if (nf_data_check(m, 2, 1))
+        return -1;
+
+    s2 = nf_data_pop(m);
+    s1 = nf_data_pop(m);
+    r = nf_strcmp((const char *)s1, (const char *)s2);
+    nf_data_push(m, (r > 0) - (r < 0));
+
+    return 0;
+}
+
+/* 'strstr' ( s1 s2 -- a ) a is the address of s2 in s1 or 0 */
+static int
+nf_str_str(struct nf_machine *m)
+{
+    nf_cell_t s1, s2;
+
+    if (nf_data_check(m, 2, 1))
+        return -1;
+
+    s2 = nf_data_pop(m);
+    s1 = nf_data_pop(m);
+    nf_data_push(m, (nf_cell_t)nf_strstr((const char *)s1, (const char *)s2));
+
+    return 0;
+}
+
+/* 'strchr' ( s c -- a ) a is the address of c in s or 0 */
+static int
+nf_str_chr(struct nf_machine *m)
+{
+    nf_cell_t s, c;
+
+    if (nf_data_check(m, 2, 1))
+        return -1;
+
+    c = nf_data_pop(m);
+    s = nf_data_pop(m);
+
+    /* include the terminator, so that it can be found too */
+    nf_data_push(m, (nf_cell_t)nf_memchr((const char *)s, (int)c,
+                                         nf_strlen((const char *)s) + 1));
+
+    return 0;
+}
+
+/* 'strcpy' ( s a -- ) copy s with its terminator to a buffer at a */
+static int
+nf_str_cpy(struct nf_machine *m)
+{
+    nf_cell_t s, a;
+    size_t len;
+
+    if (nf_data_check(m, 2, 0))
+        return -1;
+
+    a = nf_data_pop(m);
+    s = nf_data_pop(m);
+    len = nf_strlen((const char *)s) + 1;
+
+    if (nf_mem_check(m, a, (nf_cell_t)len))
+        return -1;
+
+    nf_memcpy((void *)a, (const void *)s, len);
+
+    return 0;
+}
+
+/* 'strcat' ( s1 s2 -- s ) join two strings in a new buffer */
+static int
+nf_str_cat(struct nf_machine *m)
 {
-    size_t i;
+    nf_cell_t s1, s2;
+    size_t len1, len2;
+    unsigned char *p;
+
+    if (nf_data_check(m, 2, 1))
+        return -1;
 
-    for (i = 0; i < n && src[i] != '\0'; ++i) {
-        dest[i] = src[i];
+    s2 = nf_data_pop(m);
+    s1 = nf_data_pop(m);
+    len1 = nf_strlen((const char *)s1);
+    len2 = nf_strlen((const char *)s2);
+
+    /* the buffer is zeroed, which terminates the result */
+    p = nf_mem_allot(m, (nf_cell_t)(len1 + len2 + 1));
+    if (!p) {
+        return -1;
     }
 
-    while (i < n) {
-        dest[i++] = '\0';
+    nf_memcpy(p, (const void *)s1, len1);
+    nf_memcpy(p + len1, (const void *)s2, len2);
+    nf_data_push(m, (nf_cell_t)p);
+
+    return 0;
+}
+
+/* 'number' ( s -- n 1 | 0 ) parse s as a number */
+static int
+nf_str_number(struct nf_machine *m)
+{
+    nf_cell_t s, n;
+
+    if (nf_data_check(m, 1, 2))
+        return -1;
+
+    s = nf_data_pop(m);
+
+    if (nf_parse_cell((char *)s, &n)) {
+        nf_data_push(m, 0);
+    } else {
+        nf_data_push(m, n);
+        nf_data_push(m, 1);
     }
 
-    return dest;
+    return 0;
+}
+
+#define NF_DECL_PRIM(name, data) { name, NF_WORD_PRIM, data, 0 }
+
+/* append string words to the dictionary */
+void
+nf_define_str_words(struct nf_machine *m)
+{
+    static struct nf_word words[] = {
+        NF_DECL_PRIM("strlen",  (void*)nf_str_len),
+        NF_DECL_PRIM("strcmp",  (void*)nf_str_cmp),
+        NF_DECL_PRIM("strstr",  (void*)nf_str_str),
+        NF_DECL_PRIM("strchr",  (void*)nf_str_chr),
+        NF_DECL_PRIM("strcpy",  (void*)nf_str_cpy),
+        NF_DECL_PRIM("strcat",  (void*)nf_str_cat),
+        NF_DECL_PRIM("number",  (void*)nf_str_number),
+    };
+
+    int i, count;
+
+    count = sizeof(words) / sizeof(words[0]);
+
+    for (i = 0; i < count; ++i) {
+        nf_define_word(m, &words[i]);
+    }
 }
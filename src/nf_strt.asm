@@ -14,6 +14,9 @@ section _TEXT class=CODE
 resb 0x100
 ..start:
 
+; remember where the stack begins, for nf_stack_peak
+    mov [nf_stack_start], sp
+
 ; jump to the C code
 extern main
     jmp main
@@ -28,11 +31,28 @@ nf_init_code:
 nf_init_code_end:
     db 0
 
+; prebuilt snapshot of the init code, see nf_snap.c. it's placed after
+; all other data, so that NF.COM and NF0.COM have the same layout up to here
+section _SNAP class=DATA
+
+global nf_snap_image
+global nf_snap_image_end
+
+nf_snap_image:
+%ifdef NF_SNAPSHOT
+    incbin "BUILD\NF_SNAP.BIN"
+%endif
+nf_snap_image_end:
+
 section _BSS class=BSS
+
+global nf_stack_start
+nf_stack_start:
+    resw 1
 section _BSSEND class=BSSEND
 
 ; free memory begins at the end of BSS
 global nf_heap_start
 nf_heap_start:
 
-group DGROUP _TEXT _DATA _BSS _BSSEND
+group DGROUP _TEXT _DATA _SNAP _BSS _BSSEND
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2026 luke8086.
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * nf_task.c - cooperative tasks
+ *
+ * Every task is a separate machine sharing the dictionary of the one
+ * which spawned it, running a single word on its own C stack. Tasks are
+ * switched round-robin when one of them executes 'pause', when a timer
+ * tick arrives (see nf_irq.c), or while waiting for keyboard input. The
+ * console becomes task 0 when the first task is spawned.
+ *
+ * Machines and stacks of finished tasks are reused by the next spawns,
+ * since the heap can't free memory.
+ */
+
+#include "nf_cmmn.h"
+
+enum nf_task_state {
+    NF_TASK_FREE,
+    NF_TASK_READY
+};
+
+struct nf_task {
+    int id;
+    enum nf_task_state state;
+    struct nf_machine *m;
+    struct nf_word *word;
+    void *ctx;
+    struct nf_task *next;
+};
+
+/* console task, tasks in the order of spawning and the running one */
+static NF_THREAD_LOCAL struct nf_task nf_task_console;
+static NF_THREAD_LOCAL struct nf_task *nf_task_list = 0;
+static NF_THREAD_LOCAL struct nf_task *nf_task_cur = 0;
+static NF_THREAD_LOCAL int nf_task_last_id = 0;
+
+/* local functions */
+static void nf_task_entry(void);
+static struct nf_task *nf_task_alloc(struct nf_machine *m);
+static struct nf_task *nf_task_find(nf_cell_t id);
+
+/* return amount of live tasks, including the console */
+int
+nf_task_count(void)
+{
+    struct nf_task *t;
+    int n = 0;
+
+    for (t = nf_task_list; t; t = t->next) {
+        n += (t->state == NF_TASK_READY);
+    }
+
+    return n;
+}
+
+/* switch to the next live task, if there is any other than the current one */
+void
+nf_task_yield(void)
+{
+    struct nf_task *prev = nf_task_cur;
+    struct nf_task *t = prev;
+
+    if (!prev) {
+        return;
+    }
+
+    do {
+        t = t->next ? t->next : nf_task_list;
+    } while (t != prev && t->state != NF_TASK_READY);
+
+    if (t == prev) {
+        return;
+    }
+
+    nf_task_cur = t;
+    nf_ctx_switch(prev->ctx, t->ctx);
+}
+
+/* forget all tasks, once their machines were released */
+void
+nf_task_reset(void)
+{
+    nf_task_console.next = 0;
+    nf_task_list = 0;
+    nf_task_cur = 0;
+    nf_task_last_id = 0;
+}
+
+/* first function executed on the stack of a new task */
+static void
+nf_task_entry(void)
+{
+    struct nf_task *t = nf_task_cur;
+
+    (void)nf_call_word(t->m, t->word);
+
+    /* the context of a finished task is never switched to again */
+    t->state = NF_TASK_FREE;
+
+    for (;;) {
+        nf_task_yield();
+    }
+}
+
+/* return a free task slot, or 0 if there's not enough memory */
+static struct nf_task *
+nf_task_alloc(struct nf_machine *m)
+{
+    struct nf_task *t, *last = 0;
+
+    /* register the console as task 0 */
+    if (!nf_task_list) {
+        nf_task_console.state = NF_TASK_READY;
+        nf_task_console.m = m;
+        nf_task_console.ctx = nf_ctx_main();
+        nf_task_list = nf_task_cur = &nf_task_console;
+    }
+
+    /* reuse a finished task */
+    for (t = nf_task_list; t; t = t->next) {
+        if (t->state == NF_TASK_FREE && t != nf_task_cur) {
+            t->ctx = nf_ctx_init(t->ctx, nf_task_entry);
+            return t;
+        }
+        last = t;
+    }
+
+    t = nf_malloc(sizeof(struct nf_task));
+    if (!t) {
+        return 0;
+    }
+
+    t->m = nf_init_machine(m->argc, m->argv);
+    t->ctx = t->m ? nf_ctx_init(0, nf_task_entry) : 0;
+    if (!t->ctx) {
+        return 0;
+    }
+
+    t->state = NF_TASK_FREE;
+    t->next = 0;
+    last->next = t;
+
+    return t;
+}
+
+/* find a live task by id */
+static struct nf_task *
+nf_task_find(nf_cell_t id)
+{
+    struct nf_task *t;
+
+    for (t = nf_task_list; t; t = t->next) {
+        if (t->id == id && t->state == NF_TASK_READY) {
+            return t;
+        }
+    }
+
+    return 0;
+}
+
+/* 'pause' ( -- ) */
+static int
+nf_task_pause(struct nf_machine *m)
+{
+    (void)m; /* silence compiler warning*/
+
+    nf_task_yield();
+    return 0;
+}
+
+/* 'spawn' ( s -- n ) run the word named s as a new task, return its id */
+static int
+nf_task_spawn(struct nf_machine *m)
+{
+    struct nf_word *w;
+    struct nf_task *t;
+
+    if (nf_data_check(m, 1, 1))
+        return -1;
+
+    w = nf_lookup_word(m, (char *)nf_data_pop(m));
+    if (!w) {
+        nf_error(("unknown word"));
+        return -1;
+    }
+
+    t = nf_task_alloc(m);
+    if (!t) {
+        nf_error(("out of memory"));
+        return -1;
+    }
+
+    /* a reused machine may have been killed in the middle of a word */
+    nf_reset_machine(t->m);
+
+    /* start with a clean machine sharing the dictionary */
+    t->m->words = m->words;
+    t->m->bufs = m->bufs;
+
+    t->id = ++nf_task_last_id;
+    t->word = w;
+    t->state = NF_TASK_READY;
+
+    nf_data_push(m, t->id);
+
+    return 0;
+}
+
+/* 'kill' ( n -- ) stop the task with given id */
+static int
+nf_task_kill(struct nf_machine *m)
+{
+    struct nf_task *t;
+    nf_cell_t id;
+
+    if (nf_data_check(m, 1, 0))
+        return -1;
+
+    id = nf_data_pop(m);
+    t = nf_task_find(id);
+
+    if (!t || t == &nf_task_console) {
+        nf_error(("invalid task"));
+        return -1;
+    }
+
+    /* slots are reused only when not running, see nf_task_alloc */
+    t->state = NF_TASK_FREE;
+
+    if (t == nf_task_cur) {
+        for (;;) {
+            nf_task_yield();
+        }
+    }
+
+    return 0;
+}
+
+/* 'tasks' ( -- ) */
+static int
+nf_task_list_word(struct nf_machine *m)
+{
+    struct nf_task *t;
+
+    nf_printf("%4s %-16s %s\n", "id", "word", "depth");
+
+    if (!nf_task_list) {
+        nf_printf("%4d %-16s %d\n", 0, "(console)",
+                  (int)(m->data_sp - m->data_stack));
+    }
+
+    for (t = nf_task_list; t; t = t->next) {
+        if (t->state == NF_TASK_READY) {
+            nf_printf("%4d %-16s %d\n", t->id,
+                      t->word ? t->word->name : "(console)",
+                      (int)(t->m->data_sp - t->m->data_stack));
+        }
+    }
+
+    return 0;
+}
+
+#define NF_DECL_PRIM(name, data) { name, NF_WORD_PRIM, data, 0 }
+
+/* append task words to the dictionary */
+void
+nf_define_task_words(struct nf_machine *m)
+{
+    static struct nf_word words[] = {
+        NF_DECL_PRIM("pause", (void*)nf_task_pause),
+        NF_DECL_PRIM("spawn", (void*)nf_task_spawn),
+        NF_DECL_PRIM("kill",  (void*)nf_task_kill),
+        NF_DECL_PRIM("tasks", (void*)nf_task_list_word),
+    };
+
+    int i, count;
+
+    count = sizeof(words) / sizeof(words[0]);
+
+    for (i = 0; i < count; ++i) {
+        nf_define_word(m, &words[i]);
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 luke8086.
+ * Distributed under the terms of GPL-2 License.
+ */
+
+/*
+ * nf_trce.c - execution trace
+ *
+ * nf_exec records the last NF_TRACE_SIZE CALL instructions in a ring
+ * buffer, with the called word, the index of the instruction in its code
+ * and the top of the data stack. The trace is dumped when the outermost
+ * nf_exec fails, or with 'trace.'. Define NF_NO_TRACE to leave it out.
+ */
+
+#include "nf_cmmn.h"
+
+#ifndef NF_NO_TRACE
+
+/* print the recorded calls, oldest first */
+void
+nf_trace_dump(struct nf_machine *m)
+{
+    struct nf_trace *t;
+    unsigned n, pos;
+
+    n = (m->trace_pos < NF_TRACE_SIZE) ? m->trace_pos : NF_TRACE_SIZE;
+
+    nf_printf("trace, most recent call last:\n");
+
+    for (pos = m->trace_pos - n; pos != m->trace_pos; ++pos) {
+        t = &m->trace[pos & (NF_TRACE_SIZE - 1)];
+        nf_printf("  %-16s ip %4d  top %ld\n", t->word->name, t->index, t->tos);
+    }
+}
+
+/* 'trace.' ( -- ) */
+static int
+nf_trace_print(struct nf_machine *m)
+{
+    nf_trace_dump(m);
+    return 0;
+}
+
+#define NF_DECL_PRIM(name, data) { name, NF_WORD_PRIM, data, 0 }
+
+/* append trace words to the dictionary */
+void
+nf_define_trace_words(struct nf_machine *m)
+{
+    static struct nf_word words[] = {
+        NF_DECL_PRIM("trace.", (void*)nf_trace_print),
+    };
+
+    int i, count;
+
+    count = sizeof(words) / sizeof(words[0]);
+
+    for (i = 0; i < count; ++i) {
+        nf_define_word(m, &words[i]);
+    }
+}
+
+#endif /* NF_NO_TRACE */
@@ -9,6 +9,10 @@
 
 #include "nf_cmmn.h"
 
+/* local functions */
+static int nf_run_word(struct nf_machine *m, struct nf_word *w);
+static int nf_prof_word(struct nf_machine *m, struct nf_word *w);
+
 /* initialize a new word on the heap */
 struct nf_word *
 nf_init_word(struct nf_machine *m, char *name, enum nf_word_type type, void *data)
@@ -31,17 +35,52 @@ nf_init_word(struct nf_machine *m, char *name, enum nf_word_type type, void *dat
 
     w->type = type;
     w->data = data;
+    w->fold = 0;
+    w->noinline = 0;
+    w->inlined = 0;
+    w->id = 0;
 
     nf_strncpy(w->name, name, namelen + 1);
 
     return w;
 }
 
-/* add a single word to the word dictionary */
+/* initialize a new variable on the heap, with its own storage cell */
+struct nf_word *
+nf_init_var(struct nf_machine *m, char *name, nf_cell_t val)
+{
+    nf_cell_t *cell;
+
+    cell = nf_malloc(sizeof(nf_cell_t));
+    if (!cell) {
+        return 0;
+    }
+
+    *cell = val;
+
+    return nf_init_word(m, name, NF_WORD_VAR, cell);
+}
+
+/*
+ * add a single word to the word dictionary, numbering it after the previous
+ * one. static tables of builtin words are shared by all machines, which
+ * define them in the same order, so they're only linked by the first
+ * machine. afterwards they're read-only, and machines can be created in
+ * parallel threads, see hosted/nf_batch.c
+ */
 void
 nf_define_word(struct nf_machine *m, struct nf_word *w)
 {
-    w->next = m->words;
+    unsigned id = m->words ? m->words->id + 1 : 1;
+
+    if (w->next != m->words) {
+        w->next = m->words;
+    }
+
+    if (w->id != id) {
+        w->id = id;
+    }
+
     m->words = w;
 }
 
@@ -51,8 +90,9 @@ nf_lookup_word(struct nf_machine *m, char *name)
 {
     struct nf_word *w;
 
+    /* names are short, so check the first character before calling nf_strcmp */
     for (w = m->words; w; w = w->next) {
-        if (!nf_strcmp(w->name, name)) {
+        if (w->name[0] == name[0] && !nf_strcmp(w->name, name)) {
             return w;
         }
     }
@@ -60,9 +100,67 @@ nf_lookup_word(struct nf_machine *m, char *name)
     return 0;
 }
 
+/* check if a word belongs to the dictionary shared by nf_fork_machine */
+int
+nf_word_is_shared(struct nf_machine *m, struct nf_word *w)
+{
+    struct nf_word *p;
+
+    if (!m->shared_words) {
+        return 0;
+    }
+
+    for (p = m->words; p != m->shared_words; p = p->next) {
+        if (p == w) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*
+ * return the storage cell of a variable, to be written by this machine.
+ * shared variables are read-only, so they're shadowed by a copy first.
+ * on failure, display an error and return 0
+ */
+nf_cell_t *
+nf_var_cell(struct nf_machine *m, char *name)
+{
+    struct nf_word *w = nf_lookup_word(m, name);
+
+    if (!w || w->type != NF_WORD_VAR) {
+        nf_error(("unknown variable"));
+        return 0;
+    }
+
+    if (nf_word_is_shared(m, w)) {
+        w = nf_init_var(m, name, *(nf_cell_t *)w->data);
+        if (!w) {
+            nf_error(("out of memory"));
+            return 0;
+        }
+        nf_define_word(m, w);
+    }
+
+    return (nf_cell_t *)w->data;
+}
+
 /* execute a given word */
 int
 nf_call_word(struct nf_machine *m, struct nf_word *w)
+{
+    /* when the profiler is disabled, this is its only cost */
+    if (m->profile) {
+        return nf_prof_word(m, w);
+    }
+
+    return nf_run_word(m, w);
+}
+
+/* execute a given word, without profiling */
+static int
+nf_run_word(struct nf_machine *m, struct nf_word *w)
 {
     nf_word_handler_t handler;
 
@@ -74,11 +172,45 @@ nf_call_word(struct nf_machine *m, struct nf_word *w)
     case NF_WORD_COMP:
         return nf_exec(m, w->data);
     case NF_WORD_VAR:
+    case NF_WORD_CONST:
         if (nf_data_check(m, 0, 1))
             return -1;
-        nf_data_push(m, (nf_cell_t)w->data);
+        nf_data_push(m, *(nf_cell_t *)w->data);
         return 0;
     default:
         return -1;
     }
 }
+
+/*
+ * execute a given word and update its profiler counters. time spent in
+ * nested calls is accumulated in m->prof_child, to be subtracted from
+ * the exclusive time.
+ */
+static int
+nf_prof_word(struct nf_machine *m, struct nf_word *w)
+{
+    nf_clock_t outer_child = m->prof_child;
+    nf_clock_t start, elapsed;
+    struct nf_prof_count *c;
+    int ret;
+
+    m->prof_child = 0;
+    start = nf_clock();
+
+    ret = nf_run_word(m, w);
+
+    elapsed = nf_clock() - start;
+
+    c = nf_prof_count(m, w);
+
+    if (c) {
+        c->calls++;
+        c->time_incl += elapsed;
+        c->time_excl += elapsed - m->prof_child;
+    }
+
+    m->prof_child = outer_child + elapsed;
+
+    return ret;
+}
@@ -35,7 +35,6 @@ nf_define_x86_words(struct nf_machine *m)
     count = sizeof(words) / sizeof(words[0]);
 
     for (i = 0; i < count; ++i) {
-        words[i].type = NF_WORD_PRIM;
         nf_define_word(m, &words[i]);
     }
 }